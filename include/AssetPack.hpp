@@ -0,0 +1,78 @@
+#pragma once
+
+#include <MappedFile.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Formato .pak (little endian, version 1):
+//
+//   PackHeader                       16 bytes
+//   PackEntry entries[entryCount]    ordenadas por nombre
+//   char      names[]                nombres sin terminador, uno tras otro
+//   datos                            cada entrada empieza en un multiplo de PACK_ALIGNMENT
+//
+// Los nombres son las rutas relativas de siempre ("assets/images/estrella.png"),
+// asi que el juego pide lo mismo que pediria al disco.
+const char PACK_MAGIC[4] = {'P', 'P', 'A', 'K'};
+const std::uint16_t PACK_VERSION = 1;
+const std::size_t PACK_ALIGNMENT = 4096;
+
+struct PackHeader
+{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t flags;
+    std::uint32_t entryCount;
+    std::uint32_t reserved;
+};
+static_assert(sizeof(PackHeader) == 16, "PackHeader debe medir 16 bytes");
+
+struct PackEntry
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint32_t nameOffset; // desde el inicio de la tabla de nombres
+    std::uint32_t nameLength;
+};
+static_assert(sizeof(PackEntry) == 24, "PackEntry debe medir 24 bytes");
+
+// Contenido de una entrada dentro del paquete mapeado
+struct AssetData
+{
+    const unsigned char *data = nullptr;
+    std::size_t size = 0;
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+// Paquete de assets mapeado en memoria. Abrirlo es un solo open + mmap; las
+// entradas se leen directo del mapeo sin copiarse.
+class AssetPack
+{
+public:
+    // Archivo a empaquetar: nombre dentro del paquete y ruta en disco
+    struct Source
+    {
+        std::string name;
+        std::string path;
+    };
+
+    bool open(const std::string &path);
+    bool isOpen() const { return file.isOpen(); }
+
+    // Busca una entrada por nombre (busqueda binaria sobre el indice)
+    AssetData find(const std::string &name) const;
+
+    std::size_t getEntryCount() const { return entryCount; }
+
+    // Escribe un paquete con los archivos dados
+    static bool build(const std::string &path, std::vector<Source> sources);
+
+private:
+    MappedFile file;
+    const PackEntry *entries = nullptr;
+    const char *names = nullptr;
+    std::size_t entryCount = 0;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <AssetPack.hpp>
+#include <Chart.hpp>
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <string>
+
+// Acceso a los assets del juego por su ruta de siempre ("assets/..."). Primero
+// se buscan en el paquete mapeado y, si no hay paquete o no trae la entrada,
+// en los archivos sueltos. Se puede usar desde varios hilos.
+class Assets
+{
+public:
+    // baseDir: carpeta contra la que se resuelven las rutas (la del ejecutable);
+    // si ahi no esta el archivo se prueba el directorio actual
+    explicit Assets(const std::string &baseDir);
+
+    bool openPack(const std::string &path);
+    const AssetPack &getPack() const { return pack; }
+
+    // Lo que se carga del paquete apunta directo al mapeo, que vive tanto como este objeto
+    bool loadFont(sf::Font &font, const std::string &name) const;
+    bool loadTexture(sf::Texture &texture, const std::string &name) const;
+    bool loadImage(sf::Image &image, const std::string &name) const;
+    bool openSound(sf::InputSoundFile &file, const std::string &name) const;
+    bool loadChart(Chart &chart, const std::string &name) const;
+
+    // true si la entrada esta en el paquete o como archivo suelto
+    bool exists(const std::string &name) const;
+
+    // Ruta completa de un archivo suelto
+    std::string resolve(const std::string &name) const;
+
+    // Carpeta del ejecutable, terminada en '/' (o vacia si no se pudo saber)
+    static std::string getExecutableDir(const char *argv0);
+
+private:
+    AssetPack pack;
+    std::string baseDir;
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <Simulation.hpp>
+
+// Jugador perfecto para las herramientas sin ventana (bench y chartcheck):
+// presiona cada carril en el tick mas cercano al tiempo de su siguiente nota.
+// Se llama despues de cada Simulation::update con el mismo dt.
+void autoplay(Simulation &simulation, float dt);
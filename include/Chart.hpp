@@ -0,0 +1,75 @@
+#pragma once
+
+#include <MappedFile.hpp>
+#include <Nota.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Formato binario .chart (little endian, version 1):
+//
+//   ChartHeader                     16 bytes
+//   float   times[noteCount]        segundos desde el inicio de la cancion, ordenados
+//   uint8_t columns[noteCount]      carril de cada nota o CHART_NO_COLUMN
+//
+// Los arreglos van empaquetados uno tras otro, asi que al mapear el archivo
+// se pueden leer directamente sin parsear nada.
+const char CHART_MAGIC[4] = {'P', 'T', 'C', 'H'};
+const std::uint16_t CHART_VERSION = 1;
+const std::uint8_t CHART_NO_COLUMN = 0xFF;
+
+struct ChartHeader
+{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t flags;
+    std::uint32_t noteCount;
+    std::uint32_t reserved;
+};
+static_assert(sizeof(ChartHeader) == 16, "ChartHeader debe medir 16 bytes");
+
+// Notas de una cancion. Puede venir de un .chart mapeado (sin copias) o de
+// uno de los .txt viejos, que se parsean a memoria propia.
+class Chart
+{
+public:
+    // Mapea un .chart y valida su cabecera
+    bool loadFromFile(const std::string &path);
+
+    // Igual que loadFromFile pero sobre memoria ajena (ej. una entrada del
+    // paquete de assets), que debe seguir viva mientras se use el chart
+    bool loadFromMemory(const void *data, std::size_t size);
+
+    // Lee cualquiera de los dos formatos de texto: una columna con segundos
+    // (beats.txt) o pares "ms carril", con carriles desde 0 (hard_beats.txt)
+    bool loadFromText(const std::string &path);
+
+    bool saveToFile(const std::string &path) const;
+
+    // Reemplaza las notas por unas generadas en memoria (ej. por chartgen)
+    void setNotes(const std::vector<float> &newTimes, const std::vector<std::uint8_t> &newColumns);
+
+    // Ordena las notas por tiempo (solo para charts leidos de texto).
+    // Devuelve false si ya estaban ordenadas.
+    bool sortByTime();
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const float *getTimes() const { return times; }
+    const std::uint8_t *getColumns() const { return columns; }
+
+    // Copia las notas en el formato que usa Simulation
+    std::vector<Nota> getNotes() const;
+
+private:
+    void clear();
+    bool parse(const unsigned char *data, std::size_t size);
+
+    MappedFile file;
+    std::vector<float> ownedTimes;
+    std::vector<std::uint8_t> ownedColumns;
+    const float *times = nullptr;
+    const std::uint8_t *columns = nullptr;
+    std::size_t count = 0;
+};
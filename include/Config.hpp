@@ -0,0 +1,14 @@
+#pragma once
+
+// Dimensiones de la ventana y del tablero, compartidas por el juego,
+// la simulacion y las herramientas
+const int SCREEN_WIDTH = 700;
+const int SCREEN_HEIGHT = 500;
+// Carriles del tablero, de 4 a 8; se elige al compilar (make LANES=N) y las
+// teclas, letras y tonos de cada uno estan en LaneLayout.hpp
+#ifndef PIANO_LANES
+#define PIANO_LANES 4
+#endif
+const int NUM_COLUMNS = PIANO_LANES;
+static_assert(NUM_COLUMNS >= 4 && NUM_COLUMNS <= 8, "PIANO_LANES debe estar entre 4 y 8");
+const float TILE_HEIGHT = 80.f;
@@ -1,7 +1,19 @@
-#pragma nueve
+#pragma once
+
+#include <Difficulty.hpp>
+#include <map>
 
 struct DifficultySettings
 {
     float tileSpeed;
-    float spawnInterval;
-};
\ No newline at end of file
+};
+
+// Tabla de dificultades del juego; los benchs, chartcheck y chartgen usan la misma
+inline std::map<Difficulty, DifficultySettings> makeDifficulties()
+{
+    std::map<Difficulty, DifficultySettings> difficulties;
+    difficulties[EASY] = {150.f};
+    difficulties[MEDIUM] = {250.f};
+    difficulties[HARD] = {400.f};
+    return difficulties;
+}
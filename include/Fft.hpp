@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// FFT compleja radix-2 de tamano fijo (potencia de dos). La parte real y la
+// imaginaria van en arreglos separados y cada etapa recorre sus mariposas con
+// paso 1, asi el compilador puede vectorizar los ciclos internos.
+class Fft
+{
+public:
+    explicit Fft(std::size_t size);
+
+    // Transforma re/im en su lugar (sin normalizar)
+    void forward(float *re, float *im) const;
+
+    std::size_t size() const { return n; }
+
+private:
+    std::size_t n;
+    std::vector<std::pair<std::size_t, std::size_t>> swaps; // permutacion de bits invertidos
+    std::vector<float> twiddleRe;                           // por etapa, una tras otra
+    std::vector<float> twiddleIm;
+};
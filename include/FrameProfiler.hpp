@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Fases del ciclo principal que se miden en cada cuadro
+enum ProfilePhase
+{
+    PHASE_EVENTS,     // pollEvent y manejo de teclas
+    PHASE_SIMULATION, // pasos de simulacion (spawn, movimiento, juicio de notas)
+    PHASE_HUD,        // textos del HUD
+    PHASE_TILE_BATCH, // armado de los vertex arrays de los tiles
+    PHASE_DRAW,       // draw calls
+    PHASE_DISPLAY,    // window.display()
+    PHASE_COUNT
+};
+
+// Mide cuanto tarda cada fase del cuadro con un reloj de alta resolucion.
+// Guarda una ventana movil de cuadros para sacar promedio y p99, y opcionalmente
+// escribe un CSV con una fila por cuadro.
+class FrameProfiler
+{
+public:
+    explicit FrameProfiler(std::size_t windowFrames = 240);
+
+    bool openTrace(const std::string &path);
+
+    // Cierra la fase actual (si hay) y empieza 'phase'. Las fases van una
+    // tras otra, asi que cada marca delimita el bloque anterior.
+    void beginPhase(ProfilePhase phase);
+
+    // Cierra el cuadro; drawCalls y tiles van al resumen y al CSV
+    void endFrame(std::size_t drawCalls, std::size_t tiles);
+
+    // Resumen de la ventana para el overlay: promedio y p99 por fase en ms
+    std::string getSummary() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void endPhase();
+
+    std::size_t windowFrames;
+    std::array<std::vector<float>, PHASE_COUNT> history; // ms por fase, circular
+    std::vector<float> frameHistory;                      // ms del cuadro completo
+    std::array<double, PHASE_COUNT> current{};
+    std::size_t frameIndex = 0;
+    std::size_t recordedFrames = 0;
+    std::size_t lastDrawCalls = 0;
+    std::size_t lastTiles = 0;
+
+    int activePhase = -1;
+    Clock::time_point phaseStart;
+    Clock::time_point frameStart;
+    bool frameStarted = false;
+
+    std::ofstream trace;
+};
@@ -1,4 +1,4 @@
-#pragma doce // es pa
+#pragma once
 // Estado del juego (osea si esta jugando, en el menu o si se acabo el juego)
 enum GameState
 {
@@ -6,5 +6,6 @@ enum GameState
     SHOWING_MENU, // Mostrando menú (inicio del juego al momento de inciar la partida)
     PLAYING, // Jugando (cuando el jugadador esta en partida)
     GAME_OVER,
-    GAME_WIN // Juego terminado (osea cuando el jugador a perdido) este estado se muestra cuando el jugador pierde
+    GAME_WIN, // Juego terminado (osea cuando el jugador a perdido) este estado se muestra cuando el jugador pierde
+    CALIBRATING // Midiendo la latencia con el metronomo (--calibrate)
 };
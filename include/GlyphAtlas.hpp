@@ -0,0 +1,58 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <string>
+#include <vector>
+
+// Un tamano de letra y los caracteres que se necesitan en ese tamano
+struct AtlasFace
+{
+    unsigned int characterSize;
+    std::string characters;
+};
+
+struct AtlasGlyph
+{
+    bool present = false;
+    sf::FloatRect bounds;    // caja del glifo relativa a la linea base (como sf::Glyph)
+    sf::IntRect textureRect; // en la textura del atlas, sin el padding
+    float advance = 0.f;
+};
+
+// Textura con los glifos que el juego dibuja a cada rato (letras de los
+// carriles, numeros del HUD) rasterizados una sola vez. Dibujar texto con el
+// atlas es solo agregar quads a un VertexArray, sin sf::Text.
+class GlyphAtlas
+{
+public:
+    // Rasteriza los caracteres de cada cara en una sola textura. Si la fuente y
+    // las caras son las mismas que la vez anterior no hace nada.
+    bool build(const sf::Font &font, const std::vector<AtlasFace> &faces);
+
+    const sf::Texture &getTexture() const { return texture; }
+    const AtlasGlyph *getGlyph(unsigned int characterSize, char character) const;
+
+    // Agrega el texto como quads (sf::Quads); 'position' es la esquina superior
+    // izquierda, igual que en sf::Text
+    void appendText(sf::VertexArray &quads, unsigned int characterSize, const std::string &text,
+                    sf::Vector2f position, sf::Color color) const;
+
+    // Agrega un caracter centrado en 'center'
+    void appendCentered(sf::VertexArray &quads, unsigned int characterSize, char character,
+                        sf::Vector2f center, sf::Color color) const;
+
+private:
+    struct Face
+    {
+        unsigned int characterSize;
+        std::array<AtlasGlyph, 128> glyphs;
+    };
+
+    void appendGlyph(sf::VertexArray &quads, const AtlasGlyph &glyph, sf::Vector2f origin, sf::Color color) const;
+
+    const sf::Font *builtFont = nullptr;
+    std::vector<AtlasFace> builtFaces;
+    std::vector<Face> faces;
+    sf::Texture texture;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Assets.hpp>
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Imagen a cargar y tamano al que se va a dibujar ({0, 0} = el original)
+struct ImageRequest
+{
+    std::string name;
+    sf::Vector2u size;
+};
+
+// Decodifica (y reescala) imagenes en varios hilos a la vez. Lo que queda para
+// el hilo de la ventana es solo la subida a textura, porque es el unico con el
+// contexto de OpenGL.
+class ImageLoader
+{
+public:
+    // Empieza a decodificar de inmediato; 'threads' = 0 usa uno por nucleo
+    ImageLoader(const Assets &assets, const std::vector<ImageRequest> &requests, unsigned int threads = 0);
+    ~ImageLoader();
+
+    ImageLoader(const ImageLoader &) = delete;
+    ImageLoader &operator=(const ImageLoader &) = delete;
+
+    bool isDecoded(std::size_t index) const;
+
+    // Espera a que la imagen se decodifique; false si no se pudo leer
+    bool wait(std::size_t index);
+
+    // Solo validos cuando isDecoded(index) es true
+    bool isOk(std::size_t index) const { return jobs[index].ok; }
+    const sf::Image &getImage(std::size_t index) const { return jobs[index].image; }
+    double getDecodeMs(std::size_t index) const { return jobs[index].decodeMs; }
+    double getResampleMs(std::size_t index) const { return jobs[index].resampleMs; }
+    const std::string &getName(std::size_t index) const { return jobs[index].request.name; }
+
+    // Libera la imagen decodificada (una vez subida ya no hace falta)
+    void release(std::size_t index) { jobs[index].image = sf::Image(); }
+
+    std::size_t size() const { return jobCount; }
+
+private:
+    struct Job
+    {
+        ImageRequest request;
+        sf::Image image;
+        bool ok = false;
+        double decodeMs = 0.0;
+        double resampleMs = 0.0;
+        std::atomic<bool> decoded{false};
+    };
+
+    void work();
+
+    const Assets &assets;
+    std::unique_ptr<Job[]> jobs;
+    std::size_t jobCount;
+    std::atomic<std::size_t> nextJob{0};
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable decodedSignal;
+};
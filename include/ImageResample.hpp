@@ -0,0 +1,10 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// Cambia el tamano de una imagen con un filtro triangular separable. Al
+// reducir, el filtro cubre todos los pixeles de origen que caen en cada pixel
+// de destino (sin aliasing aunque se reduzca 20 veces); al ampliar equivale a
+// bilineal. Trabaja con alfa premultiplicado para que los bordes
+// transparentes no se oscurezcan.
+sf::Image resampleImage(const sf::Image &source, sf::Vector2u size);
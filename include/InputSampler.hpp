@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Config.hpp>
+#include <SFML/Window.hpp>
+#include <SpscQueue.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+// Tecla de carril presionada y el instante exacto en que se vio
+struct LanePress
+{
+    int column;
+    std::chrono::steady_clock::time_point time;
+};
+
+// Periodo real entre lecturas del hilo de entrada
+struct SamplerStats
+{
+    std::uint64_t samples = 0;
+    double meanMs = 0.0;
+    double jitterMs = 0.0; // desviacion estandar del periodo
+    double maxMs = 0.0;
+};
+
+// Lee las teclas de los carriles en su propio hilo a frecuencia fija y manda
+// cada presion con su timestamp al hilo del juego por una cola sin locks. Asi
+// el golpe se juzga por el momento en que ocurrio y no por el cuadro en que
+// se proceso.
+//
+// SFML no garantiza que sf::Keyboard::isKeyPressed se pueda llamar fuera del
+// hilo principal (en macOS pasa por IOHIDManager y pide el permiso de
+// Monitoreo de entrada), asi que fuera de Windows solo se usa si se pide
+// con --input-hz.
+class InputSampler
+{
+public:
+    InputSampler(const std::array<sf::Keyboard::Key, NUM_COLUMNS> &keys, float hz);
+    ~InputSampler();
+
+    InputSampler(const InputSampler &) = delete;
+    InputSampler &operator=(const InputSampler &) = delete;
+
+    // isKeyPressed lee el teclado de todo el sistema, asi que solo se toman
+    // teclas mientras la ventana tiene el foco
+    void setEnabled(bool enabled) { active.store(enabled, std::memory_order_relaxed); }
+
+    // Solo el hilo del juego
+    bool poll(LanePress &event) { return events.pop(event); }
+
+    SamplerStats getStats() const;
+
+private:
+    void run();
+
+    std::array<sf::Keyboard::Key, NUM_COLUMNS> keys;
+    std::chrono::nanoseconds period;
+    SpscQueue<LanePress, 256> events;
+    std::atomic<bool> active{true};
+    std::atomic<bool> running{true};
+    std::atomic<std::uint64_t> sampleCount{0};
+    std::atomic<std::uint64_t> periodSumUs{0};
+    std::atomic<std::uint64_t> periodSquaresUs{0};
+    std::atomic<std::uint64_t> periodMaxUs{0};
+    std::thread thread;
+};
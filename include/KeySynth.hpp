@@ -0,0 +1,70 @@
+#pragma once
+
+#include <SpscQueue.hpp>
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Mezclador polifonico para el sonido de las teclas. Es un solo
+// sf::SoundStream (una sola fuente de OpenAL) con buffers chicos; cada nota
+// es una voz que lee de una tabla de onda precalculada con una envolvente
+// corta de ataque y release, asi que varias notas se pueden encimar.
+class KeySynth : public sf::SoundStream
+{
+public:
+    // framesPerBuffer define la latencia: SFML encola 3 buffers de este tamano
+    explicit KeySynth(std::size_t framesPerBuffer = 256, unsigned int sampleRate = 44100,
+                      std::size_t maxVoices = 32);
+    ~KeySynth() override;
+
+    // Se llama desde el hilo del juego; nunca bloquea
+    void trigger(float frequency, float gain = 1.f);
+
+    // Latencia medida entre que se pide un buffer y se escucha: el periodo
+    // promedio entre llamadas a onGetData por los buffers encolados
+    sf::Time getBufferLatency() const;
+
+    std::size_t getActiveVoices() const { return activeVoices.load(std::memory_order_relaxed); }
+
+protected:
+    bool onGetData(Chunk &data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+private:
+    struct Trigger
+    {
+        float frequency;
+        float gain;
+    };
+
+    struct Voice
+    {
+        bool active = false;
+        float phase = 0.f;     // posicion en la tabla de onda
+        float increment = 0.f; // avance por sample
+        float gain = 0.f;
+        std::size_t age = 0;   // samples desde que empezo
+    };
+
+    void startVoice(const Trigger &trigger);
+    void renderVoice(Voice &voice, std::size_t frames);
+
+    unsigned int sampleRate;
+    std::size_t framesPerBuffer;
+    std::size_t attackSamples;
+    std::size_t holdSamples;
+    std::size_t releaseSamples;
+
+    std::vector<Voice> voices;
+    std::vector<float> voiceBuffer;
+    std::vector<float> envelope;
+    std::vector<float> mixBuffer;
+    std::vector<sf::Int16> output;
+    SpscQueue<Trigger, 64> triggers;
+
+    std::atomic<std::size_t> activeVoices{0};
+    std::atomic<float> averageCallbackPeriod{0.f};
+    sf::Clock callbackClock;
+    bool firstCallback = true;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <LaneLayout.hpp>
+#include <SFML/Window.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Teclas de cada distribucion de LaneLayout.hpp, una especializacion por
+// cantidad de carriles
+template <int Lanes>
+struct LaneKeys;
+
+template <>
+struct LaneKeys<4>
+{
+    static constexpr std::array<sf::Keyboard::Key, 4> KEYS = {sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::K,
+                                                              sf::Keyboard::L};
+};
+
+template <>
+struct LaneKeys<5>
+{
+    static constexpr std::array<sf::Keyboard::Key, 5> KEYS = {sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::Space,
+                                                              sf::Keyboard::K, sf::Keyboard::L};
+};
+
+template <>
+struct LaneKeys<6>
+{
+    static constexpr std::array<sf::Keyboard::Key, 6> KEYS = {sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::D,
+                                                              sf::Keyboard::J, sf::Keyboard::K, sf::Keyboard::L};
+};
+
+template <>
+struct LaneKeys<7>
+{
+    static constexpr std::array<sf::Keyboard::Key, 7> KEYS = {sf::Keyboard::A,     sf::Keyboard::S, sf::Keyboard::D,
+                                                              sf::Keyboard::Space, sf::Keyboard::J, sf::Keyboard::K,
+                                                              sf::Keyboard::L};
+};
+
+template <>
+struct LaneKeys<8>
+{
+    static constexpr std::array<sf::Keyboard::Key, 8> KEYS = {sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::D,
+                                                              sf::Keyboard::F, sf::Keyboard::J, sf::Keyboard::K,
+                                                              sf::Keyboard::L, sf::Keyboard::Semicolon};
+};
+
+// Tabla tecla -> carril (-1 si la tecla no es de ningun carril)
+template <std::size_t Lanes>
+constexpr std::array<std::int8_t, sf::Keyboard::KeyCount> makeKeyToLane(const std::array<sf::Keyboard::Key, Lanes> &keys)
+{
+    std::array<std::int8_t, sf::Keyboard::KeyCount> table{};
+    for (std::size_t key = 0; key < table.size(); ++key)
+        table[key] = -1;
+    for (std::size_t lane = 0; lane < Lanes; ++lane)
+        table[keys[lane]] = static_cast<std::int8_t>(lane);
+    return table;
+}
+
+template <std::size_t Lanes>
+constexpr bool hasDistinctKeys(const std::array<sf::Keyboard::Key, Lanes> &keys)
+{
+    for (std::size_t i = 0; i < Lanes; ++i)
+        for (std::size_t j = i + 1; j < Lanes; ++j)
+            if (keys[i] == keys[j])
+                return false;
+    return true;
+}
+
+// Teclas y tabla inversa de una distribucion, armadas al compilar: buscar el
+// carril de una tecla es una sola lectura
+template <int Lanes>
+struct LaneKeyTable
+{
+    static_assert(hasDistinctKeys(LaneKeys<Lanes>::KEYS), "dos carriles con la misma tecla");
+
+    static constexpr std::array<sf::Keyboard::Key, Lanes> KEYS = LaneKeys<Lanes>::KEYS;
+    static constexpr std::array<std::int8_t, sf::Keyboard::KeyCount> KEY_TO_LANE = makeKeyToLane(KEYS);
+
+    // Carril de la tecla, o -1
+    static int laneForKey(sf::Keyboard::Key key)
+    {
+        return key >= 0 && key < sf::Keyboard::KeyCount ? KEY_TO_LANE[key] : -1;
+    }
+};
+
+using CurrentKeys = LaneKeyTable<NUM_COLUMNS>;
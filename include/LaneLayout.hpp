@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Config.hpp>
+#include <array>
+
+// Distribuciones de 4 a 8 carriles. Cada una es su propia especializacion con
+// las letras y los tonos de sus carriles; LaneLayoutBase deriva de la cantidad
+// de carriles la geometria y la comprobacion de las notas del chart. Todo se
+// resuelve al compilar: el juego usa CurrentLayout y las herramientas pueden
+// instanciar cualquiera. Las teclas estan en LaneKeys.hpp, que usa SFML.
+template <int Lanes>
+struct LaneLayoutBase
+{
+    static constexpr int LANES = Lanes;
+    static constexpr float COLUMN_WIDTH = static_cast<float>(SCREEN_WIDTH) / Lanes;
+
+    // Si una nota del chart cae en un carril de esta distribucion; las demas
+    // (incluidas las CHART_NO_COLUMN) van a un carril al azar
+    static constexpr bool isValidLane(int column) { return column >= 0 && column < Lanes; }
+};
+
+template <int Lanes>
+struct LaneLayout;
+
+// Escala de Do mayor desde C4
+constexpr float FREQ_C4 = 261.63f;
+constexpr float FREQ_D4 = 293.66f;
+constexpr float FREQ_E4 = 329.63f;
+constexpr float FREQ_F4 = 349.23f;
+constexpr float FREQ_G4 = 392.f;
+constexpr float FREQ_A4 = 440.f;
+constexpr float FREQ_B4 = 493.88f;
+constexpr float FREQ_C5 = 523.25f;
+
+template <>
+struct LaneLayout<4> : LaneLayoutBase<4>
+{
+    static constexpr std::array<char, 4> LETTERS = {'A', 'S', 'K', 'L'};
+    static constexpr std::array<float, 4> PITCHES = {FREQ_C4, FREQ_D4, FREQ_E4, FREQ_F4};
+};
+
+// Con carriles impares el del centro es la barra espaciadora
+template <>
+struct LaneLayout<5> : LaneLayoutBase<5>
+{
+    static constexpr std::array<char, 5> LETTERS = {'A', 'S', '_', 'K', 'L'};
+    static constexpr std::array<float, 5> PITCHES = {FREQ_C4, FREQ_D4, FREQ_E4, FREQ_G4, FREQ_A4};
+};
+
+template <>
+struct LaneLayout<6> : LaneLayoutBase<6>
+{
+    static constexpr std::array<char, 6> LETTERS = {'A', 'S', 'D', 'J', 'K', 'L'};
+    static constexpr std::array<float, 6> PITCHES = {FREQ_C4, FREQ_D4, FREQ_E4, FREQ_F4, FREQ_G4, FREQ_A4};
+};
+
+template <>
+struct LaneLayout<7> : LaneLayoutBase<7>
+{
+    static constexpr std::array<char, 7> LETTERS = {'A', 'S', 'D', '_', 'J', 'K', 'L'};
+    static constexpr std::array<float, 7> PITCHES = {FREQ_C4, FREQ_D4, FREQ_E4, FREQ_F4,
+                                                     FREQ_G4, FREQ_A4, FREQ_B4};
+};
+
+template <>
+struct LaneLayout<8> : LaneLayoutBase<8>
+{
+    static constexpr std::array<char, 8> LETTERS = {'A', 'S', 'D', 'F', 'J', 'K', 'L', ';'};
+    static constexpr std::array<float, 8> PITCHES = {FREQ_C4, FREQ_D4, FREQ_E4, FREQ_F4,
+                                                     FREQ_G4, FREQ_A4, FREQ_B4, FREQ_C5};
+};
+
+// La distribucion con la que se compilo el juego (make LANES=N)
+using CurrentLayout = LaneLayout<NUM_COLUMNS>;
+const float COLUMN_WIDTH = CurrentLayout::COLUMN_WIDTH;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SongCache.hpp>
+#include <TimingStats.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Desfases de latencia del equipo, en milisegundos, medidos con --calibrate.
+// audio: cuanto despues de un clic (segun el reloj de la cancion) toca el
+// jugador; visual: cuanto despues de que un tile llega a la zona de golpe.
+// Ambos incluyen la latencia de la entrada.
+struct LatencyOffsets
+{
+    float audioMs = 0.f;
+    float visualMs = 0.f;
+
+    // Archivo de texto con lineas "audio_ms X" y "visual_ms Y"
+    bool loadFromFile(const std::string &path);
+    bool saveToFile(const std::string &path) const;
+};
+
+enum CalibrationPhase
+{
+    CALIBRATION_AUDIO,  // suena el metronomo y no hay nada en pantalla
+    CALIBRATION_VISUAL, // sin sonido, un tile llega a la zona en cada tiempo
+    CALIBRATION_DONE
+};
+
+// Calibracion de latencia en dos fases con el mismo pulso: en cada una el
+// jugador toca al ritmo y cada toque se compara con el tiempo mas cercano;
+// si un tiempo recibe varios toques se queda el mas cercano, asi un toque
+// perdido no mueve el promedio. Los primeros tiempos son de entrada y no
+// cuentan. Los tiempos se miden en segundos desde el inicio de la fase.
+class LatencyCalibration
+{
+public:
+    // Los clics del metronomo como una cancion, para que suenen por el mismo
+    // PcmStream que las canciones
+    static std::shared_ptr<DecodedSong> makeMetronome(unsigned int sampleRate);
+
+    void reset();
+
+    // Devuelve true si con 'time' termino la fase actual (y paso a la siguiente)
+    bool update(float time);
+    void tap(float time);
+
+    CalibrationPhase getPhase() const { return phase; }
+    static float getBeatTime(int beat);
+    static float getBeatPeriod();
+    static int getBeatCount();
+
+    const TimingStats &getAudioStats() const { return audioTaps; }
+    const TimingStats &getVisualStats() const { return visualTaps; }
+    // Si ambas fases tienen suficientes toques para confiar en el promedio
+    bool hasEnoughTaps() const;
+    LatencyOffsets getOffsets() const;
+
+private:
+    CalibrationPhase phase = CALIBRATION_AUDIO;
+    TimingStats audioTaps;
+    TimingStats visualTaps;
+    std::vector<float> beatOffsets; // mejor toque de cada tiempo de la fase (NaN = ninguno)
+};
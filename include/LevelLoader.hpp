@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Assets.hpp>
+#include <Difficulty.hpp>
+#include <Nota.hpp>
+#include <SongCache.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Archivos de un nivel
+struct LevelInfo
+{
+    std::string beatsFile;
+    std::string musicFile;
+};
+
+// Un nivel listo para jugarse: notas en memoria y su cancion ya decodificada
+// en el cache (o, si se reproduce en streaming, solo la ruta a abrir)
+struct LoadedLevel
+{
+    std::vector<Nota> notes;
+    std::string beatsFile;
+    std::string musicFile;
+};
+
+// Prepara los niveles en un hilo de trabajo mientras se muestra el menu, para
+// que elegir uno solo tenga que tomar el estado ya listo. Si junto al .WAV de
+// un nivel hay un .ogg, .flac o .mp3 con el mismo nombre, se usa ese.
+class LevelLoader
+{
+public:
+    static const int LEVEL_COUNT = 3;
+
+    // decodeMusic = false deja las canciones sin decodificar (para el streaming)
+    LevelLoader(const std::array<LevelInfo, LEVEL_COUNT> &levels, const Assets &assets, SongCache &songCache,
+                bool decodeMusic = true);
+    ~LevelLoader();
+
+    LevelLoader(const LevelLoader &) = delete;
+    LevelLoader &operator=(const LevelLoader &) = delete;
+
+    // Empieza a preparar en segundo plano los niveles que aun no estan listos
+    void preloadAll();
+
+    bool isReady(Difficulty difficulty) const;
+    bool allReady() const;
+
+    // Solo se debe llamar cuando isReady(difficulty) es true
+    LoadedLevel &get(Difficulty difficulty);
+
+private:
+    void loadLevel(int index);
+
+    std::array<LevelInfo, LEVEL_COUNT> levels;
+    const Assets &assets;
+    SongCache &songCache;
+    bool decodeMusic;
+    std::array<std::unique_ptr<LoadedLevel>, LEVEL_COUNT> loaded;
+    std::array<std::atomic<bool>, LEVEL_COUNT> ready;
+    std::thread worker;
+};
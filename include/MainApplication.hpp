@@ -0,0 +1,150 @@
+#pragma once
+
+#include <Assets.hpp>
+#include <Config.hpp>
+#include <Difficulty.hpp>
+#include <DifficultySettings.hpp>
+#include <FrameProfiler.hpp>
+#include <GameState.hpp>
+#include <GlyphAtlas.hpp>
+#include <InputSampler.hpp>
+#include <KeySynth.hpp>
+#include <LatencyCalibration.hpp>
+#include <LaneKeys.hpp>
+#include <LevelLoader.hpp>
+#include <Options.hpp>
+#include <PcmStream.hpp>
+#include <PlaySession.hpp>
+#include <Replay.hpp>
+#include <SFML/Graphics.hpp>
+#include <SongCache.hpp>
+#include <SongClock.hpp>
+#include <StreamingMusic.hpp>
+#include <TileRenderer.hpp>
+#include <TimingStats.hpp>
+#include <UiTextures.hpp>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// El juego completo: ventana, menu, niveles, audio y la partida en curso.
+// main() solo lee las opciones y llama a run(); las piezas que se miden por
+// separado (charts, scheduler, simulacion, render de tiles) son clases aparte
+// de la biblioteca.
+class MainApplication
+{
+public:
+    // Empieza a decodificar las imagenes de la interfaz y prepara el cache y
+    // el cargador de niveles; la ventana se crea en run()
+    MainApplication(const Options &options, const char *argv0);
+
+    MainApplication(const MainApplication &) = delete;
+    MainApplication &operator=(const MainApplication &) = delete;
+
+    // Corre el juego hasta que se cierra la ventana y devuelve el codigo de salida
+    int run();
+
+private:
+    bool init();
+    void processEvents();
+    void handleEvent(const sf::Event &event);
+    void pollInput();
+    void startRequestedLevel();
+    void updatePlaying(float dt);
+    void updateHud();
+    void updateKeyFlashes(float dt);
+    void startCalibration();
+    void updateCalibration(float dt);
+    void finishCalibration();
+    void buildTiles();
+    void render();
+    void draw(const sf::Drawable &drawable);
+    void drawPlayfield();
+    void drawKeyFlashes();
+    // Al terminar una partida se guarda su grabacion; al terminar una
+    // repeticion se compara su resultado con el grabado
+    void reportSession();
+    void printStats() const;
+
+    Options options;
+    std::string exeDir;
+    Assets assets;
+    bool usingPack;
+    UiTextures uiTextures;
+    sf::RenderWindow window;
+    KeySynth keySynth;
+    std::map<Difficulty, DifficultySettings> difficulties;
+    Difficulty currentDifficulty = MEDIUM;
+    GameState currentState = SHOWING_START;
+    sf::Clock clock;
+
+    // La partida corre en PlaySession, que graba su entrada (o reproduce una
+    // grabada); el resto del juego solo lee la simulacion
+    PlaySession session;
+    Replay replay;
+    bool replayPending = false;
+    bool sessionReported = false;
+    int starsEarned = 0;
+
+    sf::Font font;
+    GlyphAtlas glyphAtlas;
+    TileRenderer tileRenderer;
+    sf::VertexArray hudQuads{sf::Quads};
+    int hudScore = -1;
+    int hudStars = -1;
+
+    SongCache songCache;
+    LevelLoader levelLoader;
+    bool levelRequested = false;
+    SongClock songClock;
+    // Latencia del equipo: se mide con --calibrate, se guarda junto al
+    // ejecutable y el reloj de la cancion la aplica en cada partida
+    std::string latencyPath;
+    LatencyOffsets latency;
+    LatencyCalibration calibration;
+    PcmStream songStream;
+    // Con --stream-music la cancion se decodifica mientras suena
+    StreamingMusic streamingMusic;
+    sf::SoundStream *music = nullptr;
+
+    // Las teclas de carril se leen en su propio hilo (por defecto solo en
+    // Windows) o de los eventos de la ventana, y se juzgan por su timestamp
+    std::unique_ptr<InputSampler> inputSampler;
+    std::vector<LanePress> presses;
+    TimingStats hitOffsets;
+    std::vector<float> keyFlashTimers;
+
+    sf::Sprite menuBackgroundSprite;
+    sf::Sprite starSprite;
+    sf::Sprite congratsSprite;
+    sf::Text startText;
+    sf::Text titleText;
+    sf::Text promptText;
+    sf::Text subtitleText;
+    sf::Text easyText;
+    sf::Text mediumText;
+    sf::Text hardText;
+    sf::Text loadingText;
+    sf::Text gameOverText;
+    sf::Text restartText;
+    sf::Text calibrationText;
+
+    sf::RectangleShape targetZone;
+    sf::VertexArray columnLines{sf::Lines};
+    // El fondo, las lineas de los carriles y la zona de golpe no cambian en
+    // toda la partida: se dibujan una vez en una textura y cada cuadro se
+    // pegan como un solo quad
+    sf::RenderTexture playfieldTexture;
+    sf::Sprite playfieldSprite;
+    bool playfieldCached = false;
+    // Destellos de las teclas; se rearma cada cuadro sin soltar su memoria
+    sf::VertexArray flashQuads{sf::Quads};
+
+    FrameProfiler profiler;
+    bool showProfiler = false;
+    std::size_t frameCount = 0;
+    std::size_t drawCalls = 0;
+    sf::Text profilerText;
+};
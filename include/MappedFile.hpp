@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Archivo mapeado en memoria de solo lectura (mmap en POSIX, MapViewOfFile en
+// Windows). El contenido queda disponible sin copiarlo ni parsearlo.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    bool open(const std::string &path);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    const unsigned char *getData() const { return static_cast<const unsigned char *>(data); }
+    std::size_t getSize() const { return size; }
+
+private:
+    void *data = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    void *fileHandle = nullptr;
+    void *mappingHandle = nullptr;
+#endif
+};
@@ -1,7 +1,11 @@
-#pragma trece
+#pragma once
+
+#include <cstdint>
+
+// Una nota del chart: segundo de la cancion en que hay que tocarla y carril
+// (CHART_NO_COLUMN si el chart no dice cual)
 struct Nota
 {
-    int tiempo_ms;
-    int columna;
-    bool mostrada = false;
+    float tiempo;
+    std::uint8_t columna;
 };
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Nota.hpp>
+#include <cstddef>
+#include <vector>
+
+// Notas de un nivel ordenadas por tiempo, con un cursor en la siguiente que
+// falta por aparecer. Cada paso solo visita las notas que entran a la ventana
+// de anticipacion, asi que el costo no depende del largo del chart.
+class NoteScheduler
+{
+public:
+    // Copia las notas (ordenandolas si hace falta) y regresa el cursor al inicio
+    void reset(const std::vector<Nota> &newNotes);
+
+    // Llama onNote(nota) por cada nota con tiempo <= horizon que no se haya
+    // entregado todavia, en orden
+    template <typename F>
+    void advance(float horizon, F &&onNote)
+    {
+        while (cursor < notes.size() && notes[cursor].tiempo <= horizon)
+            onNote(notes[cursor++]);
+    }
+
+    bool finished() const { return cursor >= notes.size(); }
+    std::size_t getCursor() const { return cursor; }
+    std::size_t size() const { return notes.size(); }
+    const std::vector<Nota> &getNotes() const { return notes; }
+
+private:
+    std::vector<Nota> notes;
+    std::size_t cursor = 0;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+struct OnsetSettings
+{
+    std::size_t frameSize = 2048;  // muestras por ventana (potencia de dos)
+    float framesPerSecond = 100.f; // define el salto entre ventanas
+    unsigned int threads = 0;      // 0 = uno por nucleo
+};
+
+// Un golpe detectado en la pista
+struct Onset
+{
+    float time;     // segundos desde el inicio de la pista
+    float strength; // flujo espectral normalizado
+    float centroid; // centroide espectral en Hz, sirve para elegir carril
+};
+
+// Deteccion de golpes por flujo espectral: en cada ventana se calcula el
+// espectro en escala logaritmica y se suma cuanto crecio cada banda respecto a
+// la ventana anterior. Los picos de esa curva son los inicios de nota.
+class OnsetDetector
+{
+public:
+    explicit OnsetDetector(const OnsetSettings &settings = OnsetSettings());
+
+    // Calcula el flujo de toda la pista (mono). Las ventanas se reparten entre
+    // hilos en bloques contiguos; cada bloque recalcula la ventana anterior a
+    // su inicio para no depender del bloque vecino.
+    void analyze(const float *samples, std::size_t count, unsigned int sampleRate);
+
+    // Picos del flujo que superan el promedio local por 'delta' desviaciones
+    // estandar y quedan al menos minGap segundos despues del anterior
+    std::vector<Onset> pickOnsets(float delta, float minGap) const;
+
+    std::size_t getFrameCount() const { return flux.size(); }
+    unsigned int getThreadCount() const { return threadsUsed; }
+
+private:
+    void analyzeRange(const float *samples, std::size_t begin, std::size_t end);
+    float frameTime(std::size_t frame) const;
+
+    OnsetSettings settings;
+    std::vector<float> window;
+    std::size_t hop = 0;
+    unsigned int sampleRate = 0;
+    unsigned int threadsUsed = 0;
+    std::vector<float> flux;
+    std::vector<float> centroids;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <SongCache.hpp>
+#include <cstddef>
+#include <string>
+
+// El hilo de entrada solo va por defecto en Windows, donde isKeyPressed es
+// GetAsyncKeyState y se puede llamar desde cualquier hilo
+#ifdef _WIN32
+const float DEFAULT_INPUT_HZ = 1000.f;
+#else
+const float DEFAULT_INPUT_HZ = 0.f;
+#endif
+
+// Opciones de linea de comandos del juego
+struct Options
+{
+    bool vsync = true;                       // sincroniza con el refresco del monitor
+    unsigned int fpsLimit = 0;               // 0 = sin limite (si no hay vsync)
+    float simulationHz = 240.f;              // frecuencia fija de la simulacion
+    std::string tracePath;                   // CSV con los tiempos de cada cuadro (vacio = no se escribe)
+    std::size_t songCacheMb = 128;           // tope del cache de canciones decodificadas
+    CachePolicy songCachePolicy = CACHE_LRU; // cual cancion se saca cuando el cache se llena
+    float inputHz = DEFAULT_INPUT_HZ;        // lectura de teclas en su hilo (0 = eventos de la ventana)
+    bool inputStats = false;                 // reporta desfase y jitter de la entrada
+    std::string recordPath;                  // graba la ultima partida en este .replay (vacio = no se graba)
+    std::string replayPath;                  // reproduce este .replay al iniciar (vacio = juego normal)
+    bool calibrate = false;                  // empieza con la calibracion de latencia
+    bool streamMusic = false;                // decodifica las canciones mientras suenan en lugar de usar el cache
+};
+
+// Devuelve false (y muestra la ayuda) si algun argumento no es valido
+bool parseOptions(int argc, char **argv, Options &options);
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <SongCache.hpp>
+#include <memory>
+
+// Reproduce una cancion ya decodificada directo desde memoria: no abre
+// archivos ni decodifica nada mientras suena.
+class PcmStream : public sf::SoundStream
+{
+public:
+    PcmStream() = default;
+    ~PcmStream();
+
+    // Cambia la cancion; se debe llamar con el stream detenido
+    void setSong(std::shared_ptr<const DecodedSong> newSong);
+    bool hasSong() const { return song != nullptr; }
+
+protected:
+    bool onGetData(Chunk &data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+private:
+    std::shared_ptr<const DecodedSong> song;
+    std::size_t position = 0; // siguiente muestra a entregar
+    std::size_t chunkSamples = 0;
+};
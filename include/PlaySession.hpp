@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Difficulty.hpp>
+#include <DifficultySettings.hpp>
+#include <Nota.hpp>
+#include <Replay.hpp>
+#include <Simulation.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Pasos de simulacion que se permiten en una sola llamada a advance(); si el
+// juego se atora mas que eso, la simulacion salta directo al tiempo actual
+const int MAX_SIM_STEPS_PER_FRAME = 64;
+
+// Una partida en pasos fijos de simulacion, grabando su entrada o
+// reproduciendo una grabacion. El juego y el bench pasan por aqui, asi que
+// una repeticion recorre exactamente la misma logica que la partida original
+// y termina con el mismo resultado.
+class PlaySession
+{
+public:
+    // Partida nueva que se graba
+    void start(const DifficultySettings &settings, const std::vector<Nota> &notes, Difficulty difficulty,
+               const std::string &chartFile, unsigned int seed, float simulationHz);
+
+    // Partida que reproduce 'replay'; las notas deben ser las de su chart
+    void startPlayback(const DifficultySettings &settings, const std::vector<Nota> &notes, const Replay &replay);
+
+    // Golpe en el segundo 'time' de la cancion. Se ignora al reproducir.
+    Judgement press(int column, float time);
+
+    // Avanza en pasos fijos hasta songTime. Al reproducir, musicStopped se
+    // toma de la grabacion y los golpes grabados se aplican en su paso; con
+    // songTime infinito corre toda la repeticion de una vez.
+    void advance(float songTime, bool musicStopped);
+
+    // Cierra la grabacion con el resultado actual (al acabar la partida o si
+    // se cierra el juego a la mitad)
+    void finish();
+
+    bool isPlayback() const { return playback != nullptr; }
+    bool isFinished() const { return finished; }
+    // Carriles golpeados por la repeticion en el ultimo advance()
+    const std::vector<int> &getPlaybackPresses() const { return playbackPresses; }
+    // Al reproducir: si el resultado coincide con el grabado
+    bool matchesRecording() const { return playback && finished && getResult() == playback->getResult(); }
+
+    ReplayResult getResult() const;
+    const Replay &getRecording() const { return recording; }
+    const Simulation &getSimulation() const { return simulation; }
+    float getSimTime() const { return simTime; }
+    float getSimStep() const { return simStep; }
+    std::uint32_t getStepCount() const { return stepCount; }
+
+private:
+    void reset(const DifficultySettings &settings, const std::vector<Nota> &notes, unsigned int seed, float simulationHz);
+    void step();
+    void record(ReplayEventType type, int column, std::int32_t value);
+    bool applyRecordedEvents();
+
+    Simulation simulation;
+    Replay recording;
+    const Replay *playback = nullptr;
+    std::size_t nextEvent = 0;
+    std::vector<int> playbackPresses;
+    float simStep = 1.f / 240.f;
+    float simTime = 0.f;
+    std::uint32_t stepCount = 0;
+    bool musicStopped = false;
+    bool finished = false;
+};
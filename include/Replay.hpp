@@ -0,0 +1,100 @@
+#pragma once
+
+#include <Difficulty.hpp>
+#include <GameState.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Formato binario .replay (little endian, version 1):
+//
+//   ReplayHeader                    40 bytes
+//   char    chartFile[nameLength]   chart que se jugo
+//   eventos, uno tras otro:
+//     varint  pasos de simulacion desde el evento anterior
+//     uint8   tipo en los 2 bits bajos, carril del golpe en el resto
+//     varint  golpe: microsegundos desde el paso actual (zigzag);
+//             salto: pasos que se saltaron; los demas no llevan valor
+//
+// Solo se guarda la entrada, junto con el paso en que se aplico, y el
+// resultado para poder verificar la reproduccion.
+const char REPLAY_MAGIC[4] = {'P', 'R', 'P', 'L'};
+const std::uint16_t REPLAY_VERSION = 1;
+
+struct ReplayHeader
+{
+    char magic[4];
+    std::uint16_t version;
+    std::uint8_t difficulty;
+    std::uint8_t finalState;
+    std::uint32_t seed;
+    float simulationHz;
+    std::uint32_t eventCount;
+    std::uint32_t nameLength;
+    std::uint32_t score;
+    std::uint32_t perfectCount;
+    std::uint32_t goodCount;
+    std::uint32_t stepCount;
+};
+static_assert(sizeof(ReplayHeader) == 40, "ReplayHeader debe medir 40 bytes");
+
+enum ReplayEventType : std::uint8_t
+{
+    REPLAY_PRESS,         // golpe en un carril
+    REPLAY_SKIP,          // el juego se atoro y salto pasos sin simularlos
+    REPLAY_MUSIC_STOPPED, // la cancion termino de sonar
+    REPLAY_END            // fin de la grabacion
+};
+
+struct ReplayEvent
+{
+    std::uint32_t step; // pasos de simulacion ya hechos cuando ocurrio
+    ReplayEventType type;
+    std::uint8_t column;
+    std::int32_t value; // microsegundos del golpe o pasos saltados
+};
+
+// Resultado con el que termino la partida grabada
+struct ReplayResult
+{
+    GameState state = PLAYING;
+    int score = 0;
+    int perfectCount = 0;
+    int goodCount = 0;
+    std::uint32_t stepCount = 0;
+
+    bool operator==(const ReplayResult &other) const
+    {
+        return state == other.state && score == other.score && perfectCount == other.perfectCount &&
+               goodCount == other.goodCount && stepCount == other.stepCount;
+    }
+};
+
+// Entrada de una partida: nivel, semilla, paso de simulacion y cada golpe
+class Replay
+{
+public:
+    void reset(Difficulty difficulty, const std::string &chartFile, unsigned int seed, float simulationHz);
+    void addEvent(const ReplayEvent &event) { events.push_back(event); }
+    void setResult(const ReplayResult &newResult) { result = newResult; }
+
+    bool saveToFile(const std::string &path) const;
+    bool loadFromFile(const std::string &path);
+
+    Difficulty getDifficulty() const { return difficulty; }
+    const std::string &getChartFile() const { return chartFile; }
+    unsigned int getSeed() const { return seed; }
+    float getSimulationHz() const { return simulationHz; }
+    const std::vector<ReplayEvent> &getEvents() const { return events; }
+    const ReplayResult &getResult() const { return result; }
+    std::size_t getPressCount() const;
+
+private:
+    Difficulty difficulty = EASY;
+    std::string chartFile;
+    unsigned int seed = 0;
+    float simulationHz = 240.f;
+    std::vector<ReplayEvent> events;
+    ReplayResult result;
+};
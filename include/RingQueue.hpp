@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Cola FIFO sobre un buffer circular que se reutiliza entre partidas; solo
+// reserva memoria si se llena. Para uso de un solo hilo.
+template <typename T>
+class RingQueue
+{
+public:
+    void reset(std::size_t minCapacity)
+    {
+        std::size_t capacity = items.empty() ? 8 : items.size();
+        while (capacity < minCapacity)
+            capacity *= 2;
+        if (capacity != items.size())
+            items.resize(capacity);
+        head = 0;
+        count = 0;
+    }
+
+    void push(const T &value)
+    {
+        if (count == items.size())
+            grow();
+        items[(head + count) & (items.size() - 1)] = value;
+        ++count;
+    }
+
+    void pop()
+    {
+        head = (head + 1) & (items.size() - 1);
+        --count;
+    }
+
+    const T &front() const { return items[head]; }
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+private:
+    void grow()
+    {
+        std::vector<T> larger(items.empty() ? 8 : items.size() * 2);
+        for (std::size_t i = 0; i < count; ++i)
+            larger[i] = items[(head + i) & (items.size() - 1)];
+        items.swap(larger);
+        head = 0;
+    }
+
+    std::vector<T> items;
+    std::size_t head = 0;
+    std::size_t count = 0;
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Config.hpp>
+#include <DifficultySettings.hpp>
+#include <GameState.hpp>
+#include <NoteScheduler.hpp>
+#include <RingQueue.hpp>
+#include <TilePool.hpp>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Zona donde hay que presionar la tecla (la franja blanca de abajo)
+const float TARGET_ZONE_TOP = SCREEN_HEIGHT - TILE_HEIGHT * 1.5f;
+const float TARGET_ZONE_HEIGHT = TILE_HEIGHT / 2;
+// y del borde superior de un tile centrado en la zona: ahi se juzga el golpe
+const float HIT_LINE_Y = TARGET_ZONE_TOP + TARGET_ZONE_HEIGHT / 2.f - TILE_HEIGHT / 2.f;
+
+// Resultado de presionar un carril
+enum Judgement
+{
+    PERFECT,
+    GOOD,
+    MISS
+};
+
+// Ventanas de tiempo (en segundos, hacia antes o despues de la nota).
+// Fuera de 'good' el golpe es MISS; una nota que pasa de 'miss' sin
+// tocarse tambien cuenta como MISS.
+struct HitWindows
+{
+    float perfect = 0.05f;
+    float good = 0.12f;
+    float miss = 0.2f;
+};
+
+// Logica del estado PLAYING sin ventana, sin musica y sin reloj real:
+// el que la usa le pasa el tiempo de la cancion y las teclas. El juego la
+// maneja con SongClock y la herramienta de bench con un reloj virtual.
+//
+// La posicion de cada tile sale directo del reloj de la cancion:
+// y = HIT_LINE_Y - (tiempo de la nota - tiempo actual) * velocidad,
+// asi que los atorones y el error de punto flotante no se acumulan.
+class Simulation
+{
+public:
+    // Cada nota sale en el carril que dice el chart; las que no traen carril
+    // (o traen uno fuera de rango) lo sacan de un generador con 'seed'
+    void start(const DifficultySettings &settings, const std::vector<Nota> &notes, unsigned int seed);
+
+    // Lleva la partida al segundo songTime de la cancion. musicStopped indica
+    // si ya termino de sonar.
+    void update(float songTime, bool musicStopped);
+
+    // Tecla del carril 'column' presionada en el segundo 'time' de la cancion
+    // (el timestamp de la tecla, no el del paso actual). Solo revisa la nota
+    // mas vieja del carril y la juzga por la diferencia entre ambos tiempos.
+    // Un MISS termina el juego.
+    Judgement press(int column, float time);
+
+    // time - tiempo de la nota del ultimo press() que encontro nota (negativo = antes)
+    float getLastOffset() const { return lastOffset; }
+
+    void setHitWindows(const HitWindows &windows) { hitWindows = windows; }
+    const HitWindows &getHitWindows() const { return hitWindows; }
+
+    // Tiempo de la siguiente nota pendiente del carril (o un numero negativo si no hay)
+    float getNextNoteTime(int column) const;
+    float getTime() const { return songTime; }
+
+    // y del tile en el slot 'slot' en el segundo 'time' de la cancion; sirve
+    // para dibujar entre dos pasos de simulacion
+    float getTileY(std::size_t slot, float time) const
+    {
+        return HIT_LINE_Y - (tiles.getNoteTime(slot) - time) * settings.tileSpeed;
+    }
+
+    // Segundos que tarda un tile desde que aparece arriba hasta la linea de golpe
+    float getLeadTime() const { return (HIT_LINE_Y + TILE_HEIGHT) / settings.tileSpeed; }
+    int getPerfectCount() const { return perfectCount; }
+    int getGoodCount() const { return goodCount; }
+
+    GameState getState() const { return state; }
+    int getScore() const { return score; }
+    int getStarsEarned() const { return starsEarned; }
+    // Las y de los tiles son su borde superior
+    const TilePool &getTiles() const { return tiles; }
+    std::size_t getNoteIndex() const { return scheduler.getCursor(); }
+    std::size_t getNoteCount() const { return scheduler.size(); }
+
+private:
+    void spawnTile(const Nota &nota);
+    std::size_t maxTilesOnScreen() const;
+
+    DifficultySettings settings{};
+    NoteScheduler scheduler;
+    TilePool tiles;
+    std::array<RingQueue<std::size_t>, NUM_COLUMNS> lanes; // secuencias de tiles pendientes
+    HitWindows hitWindows;
+    std::minstd_rand rng;
+    float songTime = 0.f;
+    float lastOffset = 0.f;
+    int score = 0;
+    int starsEarned = 0;
+    int perfectCount = 0;
+    int goodCount = 0;
+    GameState state = PLAYING;
+};
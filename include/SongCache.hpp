@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Assets;
+
+// Cancion decodificada a PCM en memoria
+struct DecodedSong
+{
+    std::vector<std::int16_t> samples; // intercaladas por canal
+    unsigned int channelCount = 0;
+    unsigned int sampleRate = 0;
+
+    std::size_t getBytes() const { return samples.size() * sizeof(std::int16_t); }
+};
+
+// A quien se saca cuando no cabe una cancion nueva
+enum CachePolicy
+{
+    CACHE_LRU, // la que lleva mas tiempo sin pedirse
+    CACHE_FIFO // la que entro primero
+};
+
+struct SongCacheStats
+{
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t evictions = 0;
+    std::size_t songs = 0;
+    std::size_t bytes = 0;
+};
+
+// Canciones decodificadas recientemente, con un tope de memoria. Reintentar
+// un nivel toma el PCM de aqui en lugar de volver a leer y decodificar el
+// archivo. Se puede usar desde varios hilos.
+class SongCache
+{
+public:
+    // Las canciones se leen por medio de 'assets' (del paquete o sueltas)
+    SongCache(const Assets &assets, std::size_t maxBytes, CachePolicy policy = CACHE_LRU);
+
+    SongCache(const SongCache &) = delete;
+    SongCache &operator=(const SongCache &) = delete;
+
+    // Devuelve la cancion, decodificandola si no estaba (nullptr si no se pudo
+    // leer). Una cancion que se saca del cache sigue viva mientras alguien la
+    // este reproduciendo.
+    std::shared_ptr<const DecodedSong> get(const std::string &path);
+
+    SongCacheStats getStats() const;
+
+private:
+    struct Entry
+    {
+        std::string path;
+        std::shared_ptr<const DecodedSong> song;
+    };
+
+    using SongFuture = std::shared_future<std::shared_ptr<const DecodedSong>>;
+
+    void store(const std::string &path, const std::shared_ptr<const DecodedSong> &song);
+    void evictFor(std::size_t size);
+
+    const Assets &assets;
+    std::size_t maxBytes;
+    CachePolicy policy;
+    // El candado cubre la lista y los indices, nunca una decodificacion
+    std::mutex mutex;
+    std::list<Entry> entries; // el frente es la que se saca al final
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    // Canciones que algun hilo esta decodificando; quien las pide espera ese resultado
+    std::unordered_map<std::string, SongFuture> pending;
+
+    // Se leen sin el candado (el overlay los pide en cada cuadro)
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+    std::atomic<std::size_t> evictions{0};
+    std::atomic<std::size_t> songs{0};
+    std::atomic<std::size_t> bytes{0};
+};
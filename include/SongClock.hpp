@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+
+// Reloj de la cancion. sf::Music::getPlayingOffset() solo avanza cada vez que
+// el stream rellena un buffer, asi que entre actualizaciones se queda quieto y
+// luego salta. Este reloj avanza con un reloj de alta resolucion y, cada vez
+// que llega un offset nuevo, corrige poco a poco la diferencia (o salta si es
+// muy grande, p. ej. despues de un atoron). Nunca retrocede.
+class SongClock
+{
+public:
+    // La cancion empieza ahora, en el segundo 0
+    void reset();
+
+    // reportedOffset: lo que reporta la musica; playing: si esta sonando.
+    // Sin musica sonando el reloj sigue solo con el tiempo real.
+    // Devuelve el tiempo de la cancion suavizado.
+    float update(float reportedOffset, bool playing);
+
+    float getTime() const { return static_cast<float>(songTime - audioLatency); }
+
+    // Tiempo de la cancion en el instante 'when' (p. ej. el timestamp de una
+    // tecla), extrapolado desde la ultima actualizacion
+    float timeAt(std::chrono::steady_clock::time_point when) const
+    {
+        return static_cast<float>(songTime - audioLatency + std::chrono::duration<double>(when - lastUpdate).count());
+    }
+
+    // Latencias medidas con --calibrate, en segundos. Todos los tiempos que
+    // devuelve el reloj (con los que se generan y juzgan las notas) van
+    // atrasados 'audio' segundos, lo que tarda en oirse la cancion; los tiles
+    // se dibujan 'visual' segundos adelante, lo que tardan en verse.
+    void setLatency(float audioSeconds, float visualSeconds)
+    {
+        audioLatency = audioSeconds;
+        visualLatency = visualSeconds;
+    }
+    float getVisualLatency() const { return static_cast<float>(visualLatency); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point lastUpdate;
+    double songTime = 0.0;
+    float lastReported = -1.f;
+    double audioLatency = 0.0;
+    double visualLatency = 0.0;
+};
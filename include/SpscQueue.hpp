@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Cola sin locks de un productor y un consumidor, con capacidad fija.
+// La usan los hilos de audio para recibir eventos del hilo del juego, y el
+// hilo de entrada para mandarle las teclas, sin bloquearse nunca.
+template <typename T, std::size_t Capacity>
+class SpscQueue
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity debe ser potencia de 2");
+
+public:
+    // Solo el productor. Devuelve false si la cola esta llena.
+    bool push(const T &value)
+    {
+        std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == Capacity)
+            return false;
+        items[tail & (Capacity - 1)] = value;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Solo el consumidor. Devuelve false si la cola esta vacia.
+    bool pop(T &value)
+    {
+        std::size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire))
+            return false;
+        value = items[head & (Capacity - 1)];
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const
+    {
+        return headIndex.load(std::memory_order_acquire) == tailIndex.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, Capacity> items{};
+    alignas(64) std::atomic<std::size_t> headIndex{0};
+    alignas(64) std::atomic<std::size_t> tailIndex{0};
+};
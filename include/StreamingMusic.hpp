@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Assets.hpp>
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Faltantes del stream desde que se abrio la cancion
+struct StreamingStats
+{
+    std::size_t underruns = 0;   // veces que el audio pidio datos y el buffer estaba vacio
+    double stallMs = 0.0;        // tiempo total que el audio espero al decodificador
+    double minBufferedMs = 0.0;  // lo menos que hubo decodificado por adelantado
+};
+
+// Reproduce una cancion comprimida (OGG, FLAC, MP3 o WAV; lo que abra
+// sf::InputSoundFile) sin decodificarla completa. Un hilo propio decodifica
+// unos cientos de ms por delante a un buffer circular sin locks, y el hilo de
+// audio de SFML solo copia de ahi, asi que una carga de CPU en el juego no
+// llega al audio mientras el buffer tenga datos.
+//
+// Si el buffer se vacia, el audio espera al decodificador en lugar de meter
+// silencio: la posicion que reporta el stream siempre es la de la cancion.
+class StreamingMusic : public sf::SoundStream
+{
+public:
+    explicit StreamingMusic(float aheadSeconds = 0.3f);
+    ~StreamingMusic() override;
+
+    StreamingMusic(const StreamingMusic &) = delete;
+    StreamingMusic &operator=(const StreamingMusic &) = delete;
+
+    // Detiene lo que sonaba, abre la cancion y espera a tener el buffer lleno
+    bool open(const Assets &assets, const std::string &path);
+    bool isOpen() const { return channelCount > 0; }
+
+    StreamingStats getStats() const;
+
+protected:
+    bool onGetData(Chunk &data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+private:
+    void startDecoder();
+    void stopDecoder();
+    void decode();
+    std::size_t buffered() const;
+
+    float aheadSeconds;
+    sf::InputSoundFile file;
+    unsigned int channelCount = 0;
+    unsigned int sampleRate = 0;
+
+    // Buffer circular de un productor (el decodificador) y un consumidor (el
+    // hilo de audio); los indices cuentan muestras y solo crecen
+    std::vector<sf::Int16> ring;
+    std::size_t mask = 0;
+    alignas(64) std::atomic<std::size_t> readIndex{0};
+    alignas(64) std::atomic<std::size_t> writeIndex{0};
+    std::atomic<bool> endOfFile{false};
+    std::atomic<bool> stopping{false};
+    std::thread decoder;
+
+    std::vector<sf::Int16> chunk;
+    std::size_t chunkSamples = 0;
+
+    std::atomic<std::size_t> underruns{0};
+    std::atomic<std::int64_t> stallMicroseconds{0};
+    std::atomic<std::size_t> minBuffered{0};
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Tiles en pantalla guardados como arreglos separados (structure of arrays)
+// dentro de un buffer circular. Los tiles salen en orden de aparicion, asi que
+// el mas viejo siempre esta en la cabeza; los que se aciertan a la mitad quedan
+// marcados hasta que los alcanza la cabeza. Con la capacidad bien calculada
+// spawn() y retire() no reservan memoria.
+//
+// Cada tile tiene un numero de secuencia que no cambia mientras vive (aunque el
+// pool crezca); su slot es siempre secuencia & mask.
+class TilePool
+{
+public:
+    enum State : std::uint8_t
+    {
+        FREE,
+        ACTIVE,
+        HIT
+    };
+
+    // Vacia el pool; solo reserva memoria si se pide mas capacidad que antes.
+    // La capacidad se redondea a potencia de 2.
+    void reset(std::size_t minCapacity);
+
+    // Devuelve la secuencia del tile nuevo
+    std::size_t spawn(int column, float y, float spawnTime, float noteTime);
+    void retire(std::size_t slot);
+
+    // Slots ocupados desde el mas viejo al mas nuevo (incluye los HIT que
+    // aun no alcanza la cabeza). slotAt(0) es el mas viejo.
+    std::size_t size() const { return count; }
+    std::size_t slotAt(std::size_t i) const { return (headSequence + i) & mask; }
+    std::size_t slotOf(std::size_t sequence) const { return sequence & mask; }
+    std::size_t capacity() const { return states.size(); }
+    std::size_t activeCount() const { return active; }
+
+    bool isActive(std::size_t slot) const { return states[slot] == ACTIVE; }
+    int getColumn(std::size_t slot) const { return columns[slot]; }
+    float getY(std::size_t slot) const { return ys[slot]; }
+    float getSpawnTime(std::size_t slot) const { return spawnTimes[slot]; }
+    // Momento en que el tile queda centrado en la zona de golpe
+    float getNoteTime(std::size_t slot) const { return noteTimes[slot]; }
+
+    // Acceso directo para los ciclos de la simulacion
+    float *yData() { return ys.data(); }
+    const float *noteTimeData() const { return noteTimes.data(); }
+    const std::uint8_t *stateData() const { return states.data(); }
+
+private:
+    void grow();
+
+    std::vector<std::uint8_t> columns;
+    std::vector<float> ys;
+    std::vector<float> spawnTimes;
+    std::vector<float> noteTimes;
+    std::vector<std::uint8_t> states;
+    std::size_t headSequence = 0;
+    std::size_t count = 0;
+    std::size_t active = 0;
+    std::size_t mask = 0;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <GlyphAtlas.hpp>
+#include <SFML/Graphics.hpp>
+
+// Dibuja todos los tiles de un frame con un numero fijo de draw calls:
+// un VertexArray con los quads (borde + relleno) y otro con las letras,
+// que salen del atlas de glifos.
+class TileRenderer
+{
+public:
+    // Las letras de los tiles deben estar en 'atlas' con 'characterSize'
+    TileRenderer(const GlyphAtlas &atlas, sf::Vector2f tileSize, unsigned int characterSize);
+
+    // Vacia los buffers; se llama una vez al inicio de cada frame
+    void clear();
+
+    // Agrega un tile con su esquina superior izquierda en 'position'
+    void addTile(sf::Vector2f position, char letter);
+
+    // Dos draw calls sin importar cuantos tiles haya en pantalla; devuelve
+    // cuantas hizo
+    std::size_t draw(sf::RenderTarget &target) const;
+
+    std::size_t getTileCount() const { return tileCount; }
+
+private:
+    void appendQuad(sf::VertexArray &array, sf::FloatRect rect, sf::Color color);
+
+    const GlyphAtlas &atlas;
+    sf::Vector2f tileSize;
+    unsigned int characterSize;
+    sf::VertexArray quads;
+    sf::VertexArray glyphs;
+    std::size_t tileCount = 0;
+};
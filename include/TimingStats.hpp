@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Guarda muestras de tiempo (en milisegundos) para sacar promedio, desviacion
+// y percentiles al final. Solo para modos de diagnostico: guarda todo.
+class TimingStats
+{
+public:
+    void add(double valueMs) { values.push_back(valueMs); }
+    void clear() { values.clear(); }
+
+    std::size_t getCount() const { return values.size(); }
+    double getMean() const;
+    double getStdDev() const;
+    // Percentil (0-100) del valor absoluto
+    double getAbsPercentile(double percentile) const;
+
+    // "n=.. media=.. ms desv=.. ms p50=.. ms p99=.. ms"
+    std::string describe() const;
+
+private:
+    std::vector<double> values;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Assets.hpp>
+#include <ImageLoader.hpp>
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+// Imagen de la interfaz: tamano en pantalla y si es chica (va en el atlas)
+struct UiImageSpec
+{
+    std::string name;
+    sf::Vector2u size;
+    bool packed;
+};
+
+// Texturas de la interfaz ya reescaladas al tamano con que se dibujan, para
+// que los sprites vayan a escala 1. Las imagenes grandes (fondos) tienen su
+// propia textura; las chicas se juntan en un atlas y comparten textura.
+class UiTextures
+{
+public:
+    UiTextures(const Assets &assets, const std::vector<UiImageSpec> &specs);
+
+    // Espera a que la imagen este lista (si va en el atlas, a todo el atlas)
+    bool wait(std::size_t index);
+
+    // Sube lo que ya se decodifico. Devuelve true si alguna imagen quedo lista.
+    bool update();
+
+    bool isReady(std::size_t index) const { return ready[index]; }
+
+    // Pone en el sprite la textura y el rectangulo de la imagen; false si
+    // todavia no esta lista
+    bool applyTo(std::size_t index, sf::Sprite &sprite) const;
+
+    // Memoria de todas las texturas subidas (RGBA)
+    std::size_t getTextureBytes() const;
+
+private:
+    void uploadSingle(std::size_t index);
+    void buildAtlas();
+
+    std::vector<UiImageSpec> specs;
+    ImageLoader loader;
+    std::vector<sf::Texture> textures; // solo se usan las de imagenes sueltas
+    sf::Texture atlas;
+    std::vector<sf::IntRect> rects;
+    std::vector<bool> done; // ya se subio (o fallo)
+    std::vector<bool> ready;
+    bool atlasDone = false;
+};
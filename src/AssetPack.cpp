@@ -0,0 +1,127 @@
+#include <AssetPack.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+bool AssetPack::open(const std::string &path)
+{
+    entries = nullptr;
+    names = nullptr;
+    entryCount = 0;
+    if (!file.open(path))
+        return false;
+
+    const unsigned char *data = file.getData();
+    std::size_t size = file.getSize();
+    PackHeader header;
+    if (size < sizeof(header))
+    {
+        file.close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    std::size_t namesBegin = sizeof(header) + static_cast<std::size_t>(header.entryCount) * sizeof(PackEntry);
+    if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 || header.version != PACK_VERSION ||
+        size < namesBegin)
+    {
+        file.close();
+        return false;
+    }
+
+    // Revisa una vez que todas las entradas caen dentro del archivo para que
+    // find() no tenga que hacerlo
+    const PackEntry *table = reinterpret_cast<const PackEntry *>(data + sizeof(header));
+    for (std::size_t i = 0; i < header.entryCount; ++i)
+    {
+        const PackEntry &entry = table[i];
+        if (namesBegin + entry.nameOffset + entry.nameLength > size || entry.offset > size ||
+            entry.size > size - entry.offset)
+        {
+            file.close();
+            return false;
+        }
+    }
+
+    entries = table;
+    names = reinterpret_cast<const char *>(data + namesBegin);
+    entryCount = header.entryCount;
+    return true;
+}
+
+AssetData AssetPack::find(const std::string &name) const
+{
+    auto compare = [this](const PackEntry &entry, const std::string &key)
+    {
+        std::size_t length = std::min<std::size_t>(entry.nameLength, key.size());
+        int order = std::memcmp(names + entry.nameOffset, key.data(), length);
+        return order < 0 || (order == 0 && entry.nameLength < key.size());
+    };
+
+    const PackEntry *end = entries + entryCount;
+    const PackEntry *entry = std::lower_bound(entries, end, name, compare);
+    if (entry == end || entry->nameLength != name.size() ||
+        std::memcmp(names + entry->nameOffset, name.data(), name.size()) != 0)
+        return AssetData();
+
+    AssetData asset;
+    asset.data = file.getData() + entry->offset;
+    asset.size = static_cast<std::size_t>(entry->size);
+    return asset;
+}
+
+bool AssetPack::build(const std::string &path, std::vector<Source> sources)
+{
+    std::sort(sources.begin(), sources.end(), [](const Source &a, const Source &b)
+              { return a.name < b.name; });
+
+    PackHeader header = {};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    header.entryCount = static_cast<std::uint32_t>(sources.size());
+
+    std::vector<PackEntry> table(sources.size());
+    std::string nameTable;
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        table[i].nameOffset = static_cast<std::uint32_t>(nameTable.size());
+        table[i].nameLength = static_cast<std::uint32_t>(sources[i].name.size());
+        nameTable += sources[i].name;
+    }
+
+    auto align = [](std::uint64_t offset)
+    { return (offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT; };
+
+    // Lee los archivos para conocer sus tamanos y acomodarlos alineados
+    std::vector<std::vector<char>> contents(sources.size());
+    std::uint64_t offset = sizeof(header) + table.size() * sizeof(PackEntry) + nameTable.size();
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        std::ifstream input(sources[i].path, std::ios::binary);
+        if (!input)
+            return false;
+        contents[i].assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        offset = align(offset);
+        table[i].offset = offset;
+        table[i].size = contents[i].size();
+        offset += contents[i].size();
+    }
+
+    std::ofstream output(path, std::ios::binary);
+    if (!output)
+        return false;
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char *>(table.data()), table.size() * sizeof(PackEntry));
+    output.write(nameTable.data(), nameTable.size());
+
+    std::uint64_t written = sizeof(header) + table.size() * sizeof(PackEntry) + nameTable.size();
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        std::vector<char> padding(static_cast<std::size_t>(table[i].offset - written), 0);
+        output.write(padding.data(), padding.size());
+        output.write(contents[i].data(), contents[i].size());
+        written = table[i].offset + table[i].size;
+    }
+    return static_cast<bool>(output);
+}
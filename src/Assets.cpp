@@ -0,0 +1,101 @@
+#include <Assets.hpp>
+
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach-o/dyld.h>
+#else
+#include <unistd.h>
+#endif
+
+Assets::Assets(const std::string &baseDir) : baseDir(baseDir)
+{
+}
+
+bool Assets::openPack(const std::string &path)
+{
+    return pack.open(path);
+}
+
+std::string Assets::resolve(const std::string &name) const
+{
+    if (!baseDir.empty())
+    {
+        std::string path = baseDir + name;
+        if (std::ifstream(path).good())
+            return path;
+    }
+    return name;
+}
+
+bool Assets::loadFont(sf::Font &font, const std::string &name) const
+{
+    if (AssetData asset = pack.find(name))
+        return font.loadFromMemory(asset.data, asset.size);
+    return font.loadFromFile(resolve(name));
+}
+
+bool Assets::loadTexture(sf::Texture &texture, const std::string &name) const
+{
+    if (AssetData asset = pack.find(name))
+        return texture.loadFromMemory(asset.data, asset.size);
+    return texture.loadFromFile(resolve(name));
+}
+
+bool Assets::loadImage(sf::Image &image, const std::string &name) const
+{
+    if (AssetData asset = pack.find(name))
+        return image.loadFromMemory(asset.data, asset.size);
+    return image.loadFromFile(resolve(name));
+}
+
+bool Assets::openSound(sf::InputSoundFile &file, const std::string &name) const
+{
+    if (AssetData asset = pack.find(name))
+        return file.openFromMemory(asset.data, asset.size);
+    return file.openFromFile(resolve(name));
+}
+
+bool Assets::loadChart(Chart &chart, const std::string &name) const
+{
+    if (AssetData asset = pack.find(name))
+        return chart.loadFromMemory(asset.data, asset.size);
+    return chart.loadFromFile(resolve(name));
+}
+
+bool Assets::exists(const std::string &name) const
+{
+    if (pack.find(name))
+        return true;
+    return std::ifstream(resolve(name)).good();
+}
+
+std::string Assets::getExecutableDir(const char *argv0)
+{
+    std::string path;
+#ifdef _WIN32
+    std::vector<char> buffer(MAX_PATH);
+    DWORD length = GetModuleFileNameA(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
+    if (length > 0 && length < buffer.size())
+        path.assign(buffer.data(), length);
+#elif defined(__APPLE__)
+    std::vector<char> buffer(4096);
+    uint32_t length = static_cast<uint32_t>(buffer.size());
+    if (_NSGetExecutablePath(buffer.data(), &length) == 0)
+        path = buffer.data();
+#else
+    std::vector<char> buffer(4096);
+    ssize_t length = readlink("/proc/self/exe", buffer.data(), buffer.size() - 1);
+    if (length > 0)
+        path.assign(buffer.data(), static_cast<std::size_t>(length));
+#endif
+    if (path.empty() && argv0)
+        path = argv0;
+
+    std::size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
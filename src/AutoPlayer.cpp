@@ -0,0 +1,13 @@
+#include <AutoPlayer.hpp>
+
+#include <Config.hpp>
+
+void autoplay(Simulation &simulation, float dt)
+{
+    for (int column = 0; column < NUM_COLUMNS; ++column)
+    {
+        float noteTime = simulation.getNextNoteTime(column);
+        if (noteTime >= 0.f && simulation.getTime() >= noteTime - dt / 2.f)
+            simulation.press(column, simulation.getTime());
+    }
+}
@@ -0,0 +1,169 @@
+#include <Chart.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <fstream>
+#include <sstream>
+
+void Chart::clear()
+{
+    file.close();
+    ownedTimes.clear();
+    ownedColumns.clear();
+    times = nullptr;
+    columns = nullptr;
+    count = 0;
+}
+
+bool Chart::loadFromFile(const std::string &path)
+{
+    clear();
+    if (!file.open(path) || !parse(file.getData(), file.getSize()))
+    {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+bool Chart::loadFromMemory(const void *data, std::size_t size)
+{
+    clear();
+    if (!parse(static_cast<const unsigned char *>(data), size))
+    {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+bool Chart::parse(const unsigned char *data, std::size_t size)
+{
+    ChartHeader header;
+    if (size < sizeof(header))
+        return false;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, CHART_MAGIC, sizeof(CHART_MAGIC)) != 0 || header.version != CHART_VERSION)
+        return false;
+
+    std::size_t expected = sizeof(header) + header.noteCount * (sizeof(float) + sizeof(std::uint8_t));
+    if (size < expected)
+        return false;
+
+    count = header.noteCount;
+    columns = data + sizeof(header) + count * sizeof(float);
+    // Un mapeo empieza alineado a pagina y la cabecera mide 16 bytes, asi que
+    // los floats quedan alineados; si la memoria viene de otro lado se copian
+    const unsigned char *timeBytes = data + sizeof(header);
+    if (reinterpret_cast<std::uintptr_t>(timeBytes) % alignof(float) == 0)
+    {
+        times = reinterpret_cast<const float *>(timeBytes);
+    }
+    else
+    {
+        ownedTimes.resize(count);
+        std::memcpy(ownedTimes.data(), timeBytes, count * sizeof(float));
+        times = ownedTimes.data();
+    }
+    return true;
+}
+
+bool Chart::loadFromText(const std::string &path)
+{
+    clear();
+    std::ifstream archivo(path);
+    if (!archivo)
+        return false;
+
+    std::string line;
+    while (std::getline(archivo, line))
+    {
+        std::istringstream tokens(line);
+        double first;
+        if (!(tokens >> first))
+            continue;
+        int column;
+        if (tokens >> column)
+        {
+            // Formato "ms carril"
+            ownedTimes.push_back(static_cast<float>(first / 1000.0));
+            ownedColumns.push_back(column >= 0 && column < CHART_NO_COLUMN ? static_cast<std::uint8_t>(column)
+                                                                            : CHART_NO_COLUMN);
+        }
+        else
+        {
+            // Formato de solo segundos
+            ownedTimes.push_back(static_cast<float>(first));
+            ownedColumns.push_back(CHART_NO_COLUMN);
+        }
+    }
+
+    times = ownedTimes.data();
+    columns = ownedColumns.data();
+    count = ownedTimes.size();
+    return true;
+}
+
+bool Chart::saveToFile(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        return false;
+
+    ChartHeader header;
+    std::memcpy(header.magic, CHART_MAGIC, sizeof(CHART_MAGIC));
+    header.version = CHART_VERSION;
+    header.flags = 0;
+    header.noteCount = static_cast<std::uint32_t>(count);
+    header.reserved = 0;
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(times), static_cast<std::streamsize>(count * sizeof(float)));
+    out.write(reinterpret_cast<const char *>(columns), static_cast<std::streamsize>(count));
+    return static_cast<bool>(out);
+}
+
+void Chart::setNotes(const std::vector<float> &newTimes, const std::vector<std::uint8_t> &newColumns)
+{
+    clear();
+    ownedTimes = newTimes;
+    ownedColumns = newColumns;
+    ownedColumns.resize(ownedTimes.size(), CHART_NO_COLUMN);
+    times = ownedTimes.data();
+    columns = ownedColumns.data();
+    count = ownedTimes.size();
+}
+
+bool Chart::sortByTime()
+{
+    if (std::is_sorted(ownedTimes.begin(), ownedTimes.end()))
+        return false;
+
+    std::vector<std::size_t> order(ownedTimes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [this](std::size_t a, std::size_t b)
+                     { return ownedTimes[a] < ownedTimes[b]; });
+
+    std::vector<float> sortedTimes(order.size());
+    std::vector<std::uint8_t> sortedColumns(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        sortedTimes[i] = ownedTimes[order[i]];
+        sortedColumns[i] = ownedColumns[order[i]];
+    }
+    ownedTimes.swap(sortedTimes);
+    ownedColumns.swap(sortedColumns);
+    times = ownedTimes.data();
+    columns = ownedColumns.data();
+    return true;
+}
+
+std::vector<Nota> Chart::getNotes() const
+{
+    std::vector<Nota> notes(count);
+    for (std::size_t i = 0; i < count; ++i)
+        notes[i] = {times[i], columns[i]};
+    return notes;
+}
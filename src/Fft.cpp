@@ -0,0 +1,70 @@
+#include <Fft.hpp>
+
+#include <cmath>
+
+namespace
+{
+// Las mariposas de un grupo: a' = a + w*b, b' = a - w*b. Con los punteros
+// marcados como restrict el compilador vectoriza este ciclo.
+void butterflies(float *__restrict ar, float *__restrict ai, float *__restrict br, float *__restrict bi,
+                 const float *__restrict wr, const float *__restrict wi, std::size_t half)
+{
+    for (std::size_t k = 0; k < half; ++k)
+    {
+        float tr = br[k] * wr[k] - bi[k] * wi[k];
+        float ti = br[k] * wi[k] + bi[k] * wr[k];
+        br[k] = ar[k] - tr;
+        bi[k] = ai[k] - ti;
+        ar[k] += tr;
+        ai[k] += ti;
+    }
+}
+} // namespace
+
+Fft::Fft(std::size_t size) : n(size)
+{
+    std::size_t bits = 0;
+    while ((std::size_t(1) << bits) < n)
+        ++bits;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::size_t reversed = 0;
+        for (std::size_t b = 0; b < bits; ++b)
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        if (i < reversed)
+            swaps.push_back({i, reversed});
+    }
+
+    // La etapa con medio tamano h usa las raices w^k = e^(-i*pi*k/h), k < h,
+    // guardadas a partir del indice h - 1
+    const double pi = 3.14159265358979323846;
+    twiddleRe.resize(n > 1 ? n - 1 : 0);
+    twiddleIm.resize(twiddleRe.size());
+    for (std::size_t half = 1; half < n; half <<= 1)
+    {
+        for (std::size_t k = 0; k < half; ++k)
+        {
+            double angle = -pi * static_cast<double>(k) / static_cast<double>(half);
+            twiddleRe[half - 1 + k] = static_cast<float>(std::cos(angle));
+            twiddleIm[half - 1 + k] = static_cast<float>(std::sin(angle));
+        }
+    }
+}
+
+void Fft::forward(float *re, float *im) const
+{
+    for (const auto &swap : swaps)
+    {
+        std::swap(re[swap.first], re[swap.second]);
+        std::swap(im[swap.first], im[swap.second]);
+    }
+
+    for (std::size_t half = 1; half < n; half <<= 1)
+    {
+        const float *wr = twiddleRe.data() + half - 1;
+        const float *wi = twiddleIm.data() + half - 1;
+        for (std::size_t start = 0; start < n; start += 2 * half)
+            butterflies(re + start, im + start, re + start + half, im + start + half, wr, wi, half);
+    }
+}
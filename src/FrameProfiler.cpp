@@ -0,0 +1,112 @@
+#include <FrameProfiler.hpp>
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+const char *PHASE_NAMES[PHASE_COUNT] = {"eventos", "simulacion", "hud", "tiles", "draw", "display"};
+
+// Promedio y percentil 99 de los primeros 'count' valores
+void computeStats(const std::vector<float> &values, std::size_t count, float &average, float &p99)
+{
+    average = 0.f;
+    p99 = 0.f;
+    if (count == 0)
+        return;
+    std::vector<float> sorted(values.begin(), values.begin() + count);
+    for (float value : sorted)
+        average += value;
+    average /= count;
+    std::size_t index = std::min(count - 1, count * 99 / 100);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    p99 = sorted[index];
+}
+}
+
+FrameProfiler::FrameProfiler(std::size_t windowFrames)
+    : windowFrames(windowFrames), frameHistory(windowFrames)
+{
+    for (auto &phaseHistory : history)
+        phaseHistory.resize(windowFrames);
+}
+
+bool FrameProfiler::openTrace(const std::string &path)
+{
+    trace.open(path);
+    if (!trace)
+        return false;
+    trace << "frame,total_ms";
+    for (const char *name : PHASE_NAMES)
+        trace << ',' << name << "_ms";
+    trace << ",draw_calls,tiles\n";
+    return true;
+}
+
+void FrameProfiler::beginPhase(ProfilePhase phase)
+{
+    Clock::time_point now = Clock::now();
+    if (!frameStarted)
+    {
+        frameStart = now;
+        frameStarted = true;
+    }
+    if (activePhase >= 0)
+        current[activePhase] += std::chrono::duration<double, std::milli>(now - phaseStart).count();
+    activePhase = phase;
+    phaseStart = now;
+}
+
+void FrameProfiler::endPhase()
+{
+    if (activePhase < 0)
+        return;
+    current[activePhase] += std::chrono::duration<double, std::milli>(Clock::now() - phaseStart).count();
+    activePhase = -1;
+}
+
+void FrameProfiler::endFrame(std::size_t drawCalls, std::size_t tiles)
+{
+    endPhase();
+    double total = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+    frameStarted = false;
+
+    std::size_t slot = frameIndex % windowFrames;
+    for (int i = 0; i < PHASE_COUNT; ++i)
+        history[i][slot] = static_cast<float>(current[i]);
+    frameHistory[slot] = static_cast<float>(total);
+
+    if (trace.is_open())
+    {
+        trace << frameIndex << ',' << total;
+        for (double value : current)
+            trace << ',' << value;
+        trace << ',' << drawCalls << ',' << tiles << '\n';
+    }
+
+    current.fill(0.0);
+    lastDrawCalls = drawCalls;
+    lastTiles = tiles;
+    ++frameIndex;
+    recordedFrames = std::min(recordedFrames + 1, windowFrames);
+}
+
+std::string FrameProfiler::getSummary() const
+{
+    std::string summary;
+    char line[96];
+    float average, p99;
+
+    computeStats(frameHistory, recordedFrames, average, p99);
+    std::snprintf(line, sizeof(line), "cuadro      %6.2f ms  p99 %6.2f\n", average, p99);
+    summary += line;
+    for (int i = 0; i < PHASE_COUNT; ++i)
+    {
+        computeStats(history[i], recordedFrames, average, p99);
+        std::snprintf(line, sizeof(line), "%-11s %6.2f ms  p99 %6.2f\n", PHASE_NAMES[i], average, p99);
+        summary += line;
+    }
+    std::snprintf(line, sizeof(line), "draw calls %zu  tiles %zu", lastDrawCalls, lastTiles);
+    summary += line;
+    return summary;
+}
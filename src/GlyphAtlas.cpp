@@ -0,0 +1,157 @@
+#include <GlyphAtlas.hpp>
+
+#include <algorithm>
+#include <map>
+
+namespace
+{
+const unsigned int ATLAS_WIDTH = 256;
+// Mismo padding que usa sf::Text alrededor de cada glifo, para no recortar el antialias
+const int GLYPH_PADDING = 1;
+}
+
+bool GlyphAtlas::build(const sf::Font &font, const std::vector<AtlasFace> &newFaces)
+{
+    bool sameFaces = builtFaces.size() == newFaces.size() &&
+                     std::equal(builtFaces.begin(), builtFaces.end(), newFaces.begin(),
+                                [](const AtlasFace &a, const AtlasFace &b)
+                                { return a.characterSize == b.characterSize && a.characters == b.characters; });
+    if (builtFont == &font && sameFaces)
+        return true;
+
+    // Primero se cargan todos los glifos en la fuente y luego se copia la
+    // textura de cada tamano una sola vez
+    faces.clear();
+    std::map<unsigned int, sf::Image> sources;
+    for (const AtlasFace &face : newFaces)
+    {
+        for (char c : face.characters)
+            font.getGlyph(static_cast<sf::Uint32>(c), face.characterSize, false);
+    }
+    for (const AtlasFace &face : newFaces)
+    {
+        if (sources.find(face.characterSize) == sources.end())
+            sources[face.characterSize] = font.getTexture(face.characterSize).copyToImage();
+    }
+
+    // Acomoda los glifos en filas (shelf packing)
+    struct Placement
+    {
+        std::size_t face;
+        char character;
+        sf::IntRect source;
+        sf::Vector2i target;
+    };
+    std::vector<Placement> placements;
+    int x = GLYPH_PADDING;
+    int y = GLYPH_PADDING;
+    int rowHeight = 0;
+    for (std::size_t f = 0; f < newFaces.size(); ++f)
+    {
+        faces.push_back({newFaces[f].characterSize, {}});
+        for (char c : newFaces[f].characters)
+        {
+            unsigned char index = static_cast<unsigned char>(c);
+            if (index >= 128 || faces[f].glyphs[index].present)
+                continue;
+            const sf::Glyph &glyph = font.getGlyph(static_cast<sf::Uint32>(c), newFaces[f].characterSize, false);
+            int width = glyph.textureRect.width + 2 * GLYPH_PADDING;
+            int height = glyph.textureRect.height + 2 * GLYPH_PADDING;
+            if (x + width > static_cast<int>(ATLAS_WIDTH))
+            {
+                x = GLYPH_PADDING;
+                y += rowHeight;
+                rowHeight = 0;
+            }
+
+            AtlasGlyph &atlasGlyph = faces[f].glyphs[index];
+            atlasGlyph.present = true;
+            atlasGlyph.bounds = glyph.bounds;
+            atlasGlyph.advance = glyph.advance;
+            atlasGlyph.textureRect = sf::IntRect(x + GLYPH_PADDING, y + GLYPH_PADDING,
+                                                 glyph.textureRect.width, glyph.textureRect.height);
+            sf::IntRect source(glyph.textureRect.left - GLYPH_PADDING, glyph.textureRect.top - GLYPH_PADDING,
+                               width, height);
+            placements.push_back({f, c, source, {x, y}});
+
+            x += width;
+            rowHeight = std::max(rowHeight, height);
+        }
+    }
+
+    sf::Image image;
+    image.create(ATLAS_WIDTH, static_cast<unsigned int>(y + rowHeight + GLYPH_PADDING), sf::Color(255, 255, 255, 0));
+    for (const Placement &placement : placements)
+    {
+        const sf::Image &source = sources[faces[placement.face].characterSize];
+        image.copy(source, static_cast<unsigned int>(placement.target.x), static_cast<unsigned int>(placement.target.y),
+                   placement.source);
+    }
+    if (!texture.loadFromImage(image))
+        return false;
+    texture.setSmooth(true);
+
+    builtFont = &font;
+    builtFaces = newFaces;
+    return true;
+}
+
+const AtlasGlyph *GlyphAtlas::getGlyph(unsigned int characterSize, char character) const
+{
+    unsigned char index = static_cast<unsigned char>(character);
+    if (index >= 128)
+        return nullptr;
+    for (const Face &face : faces)
+    {
+        if (face.characterSize == characterSize && face.glyphs[index].present)
+            return &face.glyphs[index];
+    }
+    return nullptr;
+}
+
+void GlyphAtlas::appendGlyph(sf::VertexArray &quads, const AtlasGlyph &glyph, sf::Vector2f origin, sf::Color color) const
+{
+    const float padding = static_cast<float>(GLYPH_PADDING);
+    float left = origin.x + glyph.bounds.left - padding;
+    float top = origin.y + glyph.bounds.top - padding;
+    float right = origin.x + glyph.bounds.left + glyph.bounds.width + padding;
+    float bottom = origin.y + glyph.bounds.top + glyph.bounds.height + padding;
+
+    const sf::IntRect &tex = glyph.textureRect;
+    float u0 = static_cast<float>(tex.left) - padding;
+    float v0 = static_cast<float>(tex.top) - padding;
+    float u1 = static_cast<float>(tex.left + tex.width) + padding;
+    float v1 = static_cast<float>(tex.top + tex.height) + padding;
+
+    quads.append(sf::Vertex({left, top}, color, {u0, v0}));
+    quads.append(sf::Vertex({right, top}, color, {u1, v0}));
+    quads.append(sf::Vertex({right, bottom}, color, {u1, v1}));
+    quads.append(sf::Vertex({left, bottom}, color, {u0, v1}));
+}
+
+void GlyphAtlas::appendText(sf::VertexArray &quads, unsigned int characterSize, const std::string &text,
+                            sf::Vector2f position, sf::Color color) const
+{
+    // sf::Text pone la linea base a characterSize pixeles de su esquina superior
+    sf::Vector2f pen(position.x, position.y + static_cast<float>(characterSize));
+    for (char c : text)
+    {
+        const AtlasGlyph *glyph = getGlyph(characterSize, c);
+        if (!glyph)
+            continue;
+        if (glyph->bounds.width > 0.f)
+            appendGlyph(quads, *glyph, pen, color);
+        pen.x += glyph->advance;
+    }
+}
+
+void GlyphAtlas::appendCentered(sf::VertexArray &quads, unsigned int characterSize, char character,
+                                sf::Vector2f center, sf::Color color) const
+{
+    const AtlasGlyph *glyph = getGlyph(characterSize, character);
+    if (!glyph)
+        return;
+    sf::Vector2f origin(center.x - glyph->bounds.left - glyph->bounds.width / 2.f,
+                        center.y - glyph->bounds.top - glyph->bounds.height / 2.f);
+    appendGlyph(quads, *glyph, origin, color);
+}
@@ -0,0 +1,72 @@
+#include <ImageLoader.hpp>
+
+#include <ImageResample.hpp>
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+double millisecondsSince(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+} // namespace
+
+ImageLoader::ImageLoader(const Assets &assets, const std::vector<ImageRequest> &requests, unsigned int threads)
+    : assets(assets), jobs(new Job[requests.size()]), jobCount(requests.size())
+{
+    for (std::size_t i = 0; i < jobCount; ++i)
+        jobs[i].request = requests[i];
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned int>(std::min<std::size_t>(threads, jobCount));
+    for (unsigned int i = 0; i < threads; ++i)
+        workers.emplace_back([this]()
+                             { work(); });
+}
+
+ImageLoader::~ImageLoader()
+{
+    for (auto &worker : workers)
+        worker.join();
+}
+
+void ImageLoader::work()
+{
+    // Cada hilo toma la siguiente imagen pendiente hasta que no quede ninguna
+    for (std::size_t index = nextJob++; index < jobCount; index = nextJob++)
+    {
+        Job &job = jobs[index];
+        auto begin = std::chrono::steady_clock::now();
+        job.ok = assets.loadImage(job.image, job.request.name);
+        job.decodeMs = millisecondsSince(begin);
+
+        sf::Vector2u size = job.request.size;
+        if (job.ok && size.x > 0 && size.y > 0 && size != job.image.getSize())
+        {
+            begin = std::chrono::steady_clock::now();
+            job.image = resampleImage(job.image, size);
+            job.resampleMs = millisecondsSince(begin);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job.decoded.store(true, std::memory_order_release);
+        }
+        decodedSignal.notify_all();
+    }
+}
+
+bool ImageLoader::isDecoded(std::size_t index) const
+{
+    return jobs[index].decoded.load(std::memory_order_acquire);
+}
+
+bool ImageLoader::wait(std::size_t index)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    decodedSignal.wait(lock, [this, index]()
+                       { return isDecoded(index); });
+    return jobs[index].ok;
+}
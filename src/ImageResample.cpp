@@ -0,0 +1,113 @@
+#include <ImageResample.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+// Pesos de los pixeles de origen para cada pixel de destino en un eje
+struct Contributions
+{
+    std::vector<unsigned int> first; // primer pixel de origen de cada destino
+    std::vector<unsigned int> count;
+    std::vector<float> weights;      // count[i] pesos por destino, uno tras otro
+    std::vector<std::size_t> offset; // inicio de los pesos de cada destino
+};
+
+Contributions computeContributions(unsigned int sourceSize, unsigned int targetSize)
+{
+    Contributions result;
+    float ratio = static_cast<float>(sourceSize) / targetSize;
+    float radius = std::max(1.f, ratio);
+    for (unsigned int i = 0; i < targetSize; ++i)
+    {
+        float center = (i + 0.5f) * ratio;
+        int begin = std::max(0, static_cast<int>(std::floor(center - radius)));
+        int end = std::min(static_cast<int>(sourceSize), static_cast<int>(std::ceil(center + radius)));
+
+        result.first.push_back(static_cast<unsigned int>(begin));
+        result.offset.push_back(result.weights.size());
+        float total = 0.f;
+        for (int j = begin; j < end; ++j)
+        {
+            float weight = std::max(0.f, 1.f - std::fabs(j + 0.5f - center) / radius);
+            result.weights.push_back(weight);
+            total += weight;
+        }
+        for (std::size_t k = result.offset.back(); k < result.weights.size(); ++k)
+            result.weights[k] /= total;
+        result.count.push_back(static_cast<unsigned int>(end - begin));
+    }
+    return result;
+}
+} // namespace
+
+sf::Image resampleImage(const sf::Image &source, sf::Vector2u size)
+{
+    sf::Vector2u sourceSize = source.getSize();
+    if (size == sourceSize || size.x == 0 || size.y == 0 || sourceSize.x == 0 || sourceSize.y == 0)
+        return source;
+
+    // Pasa a flotantes con alfa premultiplicado
+    const sf::Uint8 *pixels = source.getPixelsPtr();
+    std::vector<float> input(static_cast<std::size_t>(sourceSize.x) * sourceSize.y * 4);
+    for (std::size_t p = 0; p < input.size(); p += 4)
+    {
+        float alpha = pixels[p + 3] / 255.f;
+        input[p] = pixels[p] * alpha;
+        input[p + 1] = pixels[p + 1] * alpha;
+        input[p + 2] = pixels[p + 2] * alpha;
+        input[p + 3] = pixels[p + 3];
+    }
+
+    // Primero horizontal y luego vertical
+    Contributions horizontal = computeContributions(sourceSize.x, size.x);
+    std::vector<float> rows(static_cast<std::size_t>(size.x) * sourceSize.y * 4, 0.f);
+    for (unsigned int y = 0; y < sourceSize.y; ++y)
+    {
+        const float *in = &input[static_cast<std::size_t>(y) * sourceSize.x * 4];
+        float *out = &rows[static_cast<std::size_t>(y) * size.x * 4];
+        for (unsigned int x = 0; x < size.x; ++x)
+        {
+            const float *weights = &horizontal.weights[horizontal.offset[x]];
+            const float *from = in + horizontal.first[x] * 4;
+            for (unsigned int k = 0; k < horizontal.count[x]; ++k)
+            {
+                for (int c = 0; c < 4; ++c)
+                    out[x * 4 + c] += from[k * 4 + c] * weights[k];
+            }
+        }
+    }
+
+    Contributions vertical = computeContributions(sourceSize.y, size.y);
+    std::vector<float> columns(static_cast<std::size_t>(size.x) * size.y * 4, 0.f);
+    const std::size_t stride = static_cast<std::size_t>(size.x) * 4;
+    for (unsigned int y = 0; y < size.y; ++y)
+    {
+        float *out = &columns[y * stride];
+        const float *weights = &vertical.weights[vertical.offset[y]];
+        for (unsigned int k = 0; k < vertical.count[y]; ++k)
+        {
+            const float *in = &rows[(vertical.first[y] + k) * stride];
+            float weight = weights[k];
+            for (std::size_t i = 0; i < stride; ++i)
+                out[i] += in[i] * weight;
+        }
+    }
+
+    // De regreso a 8 bits sin premultiplicar
+    std::vector<sf::Uint8> result(columns.size());
+    for (std::size_t p = 0; p < columns.size(); p += 4)
+    {
+        float alpha = columns[p + 3];
+        float unpremultiply = alpha > 0.f ? 255.f / alpha : 0.f;
+        for (int c = 0; c < 3; ++c)
+            result[p + c] = static_cast<sf::Uint8>(std::min(255.f, columns[p + c] * unpremultiply + 0.5f));
+        result[p + 3] = static_cast<sf::Uint8>(std::min(255.f, alpha + 0.5f));
+    }
+
+    sf::Image image;
+    image.create(size.x, size.y, result.data());
+    return image;
+}
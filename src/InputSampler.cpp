@@ -0,0 +1,72 @@
+#include <InputSampler.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+InputSampler::InputSampler(const std::array<sf::Keyboard::Key, NUM_COLUMNS> &keys, float hz)
+    : keys(keys), period(static_cast<std::int64_t>(1e9 / hz))
+{
+    thread = std::thread([this]()
+                         { run(); });
+}
+
+InputSampler::~InputSampler()
+{
+    running.store(false, std::memory_order_relaxed);
+    thread.join();
+}
+
+void InputSampler::run()
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::array<bool, NUM_COLUMNS> wasPressed{};
+    Clock::time_point previous = Clock::now();
+    Clock::time_point next = previous;
+    while (running.load(std::memory_order_relaxed))
+    {
+        Clock::time_point now = Clock::now();
+        bool enabled = active.load(std::memory_order_relaxed);
+        for (int column = 0; column < NUM_COLUMNS; ++column)
+        {
+            bool pressed = enabled && sf::Keyboard::isKeyPressed(keys[column]);
+            // Si la cola se llena se pierde la presion: el juego lleva mas de
+            // 256 teclas sin procesar, asi que de todos modos no iba a contar
+            if (pressed && !wasPressed[column])
+                events.push({column, now});
+            wasPressed[column] = pressed;
+        }
+
+        std::uint64_t elapsedUs = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - previous).count());
+        previous = now;
+        sampleCount.fetch_add(1, std::memory_order_relaxed);
+        periodSumUs.fetch_add(elapsedUs, std::memory_order_relaxed);
+        periodSquaresUs.fetch_add(elapsedUs * elapsedUs, std::memory_order_relaxed);
+        if (elapsedUs > periodMaxUs.load(std::memory_order_relaxed))
+            periodMaxUs.store(elapsedUs, std::memory_order_relaxed);
+
+        // Se duerme hasta la siguiente lectura; si el hilo se atraso no
+        // intenta recuperar las lecturas perdidas
+        next += period;
+        if (next < now)
+            next = now + period;
+        std::this_thread::sleep_until(next);
+    }
+}
+
+SamplerStats InputSampler::getStats() const
+{
+    SamplerStats stats;
+    // La primera lectura no tiene periodo anterior
+    stats.samples = sampleCount.load(std::memory_order_relaxed);
+    if (stats.samples < 2)
+        return stats;
+    double count = static_cast<double>(stats.samples - 1);
+    double mean = periodSumUs.load(std::memory_order_relaxed) / count;
+    double meanSquares = periodSquaresUs.load(std::memory_order_relaxed) / count;
+    stats.meanMs = mean / 1000.0;
+    stats.jitterMs = std::sqrt(std::max(0.0, meanSquares - mean * mean)) / 1000.0;
+    stats.maxMs = periodMaxUs.load(std::memory_order_relaxed) / 1000.0;
+    return stats;
+}
@@ -0,0 +1,172 @@
+#include <KeySynth.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace
+{
+const std::size_t TABLE_SIZE = 2048;
+const unsigned int STREAM_BUFFER_COUNT = 3; // buffers que SFML mantiene encolados
+const float ATTACK_SECONDS = 0.003f;
+const float HOLD_SECONDS = 0.25f;
+const float RELEASE_SECONDS = 0.05f;
+const float MASTER_GAIN = 20000.f / 32767.f; // mismo volumen que el AMPLITUDE original
+
+// Un ciclo de seno, con una muestra extra al final para interpolar sin
+// revisar el borde
+const std::vector<float> &sineTable()
+{
+    static const std::vector<float> table = []()
+    {
+        std::vector<float> values(TABLE_SIZE + 1);
+        for (std::size_t i = 0; i <= TABLE_SIZE; ++i)
+            values[i] = static_cast<float>(std::sin(2.0 * M_PI * static_cast<double>(i) / TABLE_SIZE));
+        return values;
+    }();
+    return table;
+}
+}
+
+KeySynth::KeySynth(std::size_t framesPerBuffer, unsigned int sampleRate, std::size_t maxVoices)
+    : sampleRate(sampleRate), framesPerBuffer(framesPerBuffer),
+      attackSamples(std::max<std::size_t>(1, static_cast<std::size_t>(ATTACK_SECONDS * sampleRate))),
+      holdSamples(static_cast<std::size_t>(HOLD_SECONDS * sampleRate)),
+      releaseSamples(std::max<std::size_t>(1, static_cast<std::size_t>(RELEASE_SECONDS * sampleRate))),
+      voices(maxVoices), voiceBuffer(framesPerBuffer), envelope(framesPerBuffer),
+      mixBuffer(framesPerBuffer), output(framesPerBuffer)
+{
+    sineTable();
+    initialize(1, sampleRate);
+    // Revisa los buffers seguido; con el intervalo por defecto (10 ms) los
+    // buffers chicos se quedarian sin rellenar a tiempo
+    setProcessingInterval(sf::milliseconds(1));
+}
+
+KeySynth::~KeySynth()
+{
+    // El hilo de streaming de SFML usa los miembros de esta clase
+    stop();
+}
+
+void KeySynth::trigger(float frequency, float gain)
+{
+    triggers.push({frequency, gain});
+}
+
+sf::Time KeySynth::getBufferLatency() const
+{
+    float period = averageCallbackPeriod.load(std::memory_order_relaxed);
+    if (period <= 0.f)
+        period = static_cast<float>(framesPerBuffer) / sampleRate;
+    return sf::seconds(period * STREAM_BUFFER_COUNT);
+}
+
+void KeySynth::onSeek(sf::Time)
+{
+}
+
+void KeySynth::startVoice(const Trigger &trigger)
+{
+    // Usa una voz libre o, si no hay, la mas vieja
+    Voice *slot = &voices[0];
+    for (auto &voice : voices)
+    {
+        if (!voice.active)
+        {
+            slot = &voice;
+            break;
+        }
+        if (voice.age > slot->age)
+            slot = &voice;
+    }
+    slot->active = true;
+    slot->phase = 0.f;
+    slot->increment = trigger.frequency * TABLE_SIZE / sampleRate;
+    slot->gain = trigger.gain * MASTER_GAIN;
+    slot->age = 0;
+}
+
+void KeySynth::renderVoice(Voice &voice, std::size_t frames)
+{
+    const std::vector<float> &table = sineTable();
+
+    // Lectura de la tabla con interpolacion lineal
+    float phase = voice.phase;
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        std::size_t index = static_cast<std::size_t>(phase);
+        float frac = phase - static_cast<float>(index);
+        voiceBuffer[i] = table[index] + (table[index + 1] - table[index]) * frac;
+        phase += voice.increment;
+        if (phase >= TABLE_SIZE)
+            phase -= TABLE_SIZE;
+    }
+    voice.phase = phase;
+
+    // Envolvente ataque/sostenido/release sin saltos, para que el compilador
+    // pueda vectorizar este ciclo y el de la mezcla
+    const float age = static_cast<float>(voice.age);
+    const float attack = static_cast<float>(attackSamples);
+    const float end = static_cast<float>(attackSamples + holdSamples + releaseSamples);
+    const float release = static_cast<float>(releaseSamples);
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        float t = age + static_cast<float>(i);
+        float rise = std::min(t / attack, 1.f);
+        float fall = std::min(std::max((end - t) / release, 0.f), 1.f);
+        envelope[i] = rise * fall * voice.gain;
+    }
+
+    float *mix = mixBuffer.data();
+    const float *samples = voiceBuffer.data();
+    const float *env = envelope.data();
+    for (std::size_t i = 0; i < frames; ++i)
+        mix[i] += samples[i] * env[i];
+
+    voice.age += frames;
+    if (voice.age >= attackSamples + holdSamples + releaseSamples)
+        voice.active = false;
+}
+
+bool KeySynth::onGetData(Chunk &data)
+{
+    // Promedio movil del tiempo entre buffers pedidos
+    float elapsed = callbackClock.restart().asSeconds();
+    if (!firstCallback)
+    {
+        float average = averageCallbackPeriod.load(std::memory_order_relaxed);
+        average = average <= 0.f ? elapsed : average * 0.95f + elapsed * 0.05f;
+        averageCallbackPeriod.store(average, std::memory_order_relaxed);
+    }
+    firstCallback = false;
+
+    Trigger trigger;
+    while (triggers.pop(trigger))
+        startVoice(trigger);
+
+    std::fill(mixBuffer.begin(), mixBuffer.end(), 0.f);
+    std::size_t active = 0;
+    for (auto &voice : voices)
+    {
+        if (voice.active)
+        {
+            renderVoice(voice, framesPerBuffer);
+            ++active;
+        }
+    }
+    activeVoices.store(active, std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < framesPerBuffer; ++i)
+    {
+        float value = std::min(std::max(mixBuffer[i], -1.f), 1.f);
+        output[i] = static_cast<sf::Int16>(value * 32767.f);
+    }
+
+    data.samples = output.data();
+    data.sampleCount = output.size();
+    return true;
+}
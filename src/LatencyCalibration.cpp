@@ -0,0 +1,139 @@
+#include <LatencyCalibration.hpp>
+
+#include <cmath>
+#include <fstream>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace
+{
+const float BPM = 100.f;
+const float FIRST_BEAT = 1.f; // segundos antes del primer tiempo
+const int COUNT_IN_BEATS = 4; // tiempos para agarrar el ritmo, no cuentan
+const int MEASURED_BEATS = 20;
+const float PHASE_TAIL = 1.f; // segundos despues del ultimo tiempo
+const std::size_t MIN_TAPS = 8;
+
+// Clic: seno corto con caida exponencial; el primero de cada compas mas agudo
+const float CLICK_SECONDS = 0.03f;
+const float CLICK_HZ = 1000.f;
+const float ACCENT_HZ = 1500.f;
+const float CLICK_AMPLITUDE = 20000.f;
+}
+
+bool LatencyOffsets::loadFromFile(const std::string &path)
+{
+    std::ifstream in(path);
+    if (!in)
+        return false;
+    std::string key;
+    float value;
+    bool found = false;
+    while (in >> key >> value)
+    {
+        if (key == "audio_ms")
+            audioMs = value;
+        else if (key == "visual_ms")
+            visualMs = value;
+        else
+            continue;
+        found = true;
+    }
+    return found;
+}
+
+bool LatencyOffsets::saveToFile(const std::string &path) const
+{
+    std::ofstream out(path);
+    out << "audio_ms " << audioMs << "\n"
+        << "visual_ms " << visualMs << "\n";
+    return static_cast<bool>(out);
+}
+
+std::shared_ptr<DecodedSong> LatencyCalibration::makeMetronome(unsigned int sampleRate)
+{
+    auto song = std::make_shared<DecodedSong>();
+    song->channelCount = 1;
+    song->sampleRate = sampleRate;
+    float length = getBeatTime(getBeatCount() - 1) + PHASE_TAIL;
+    song->samples.assign(static_cast<std::size_t>(length * sampleRate), 0);
+
+    std::size_t clickSamples = static_cast<std::size_t>(CLICK_SECONDS * sampleRate);
+    for (int beat = 0; beat < getBeatCount(); ++beat)
+    {
+        double frequency = beat % 4 == 0 ? ACCENT_HZ : CLICK_HZ;
+        std::size_t start = static_cast<std::size_t>(std::lround(getBeatTime(beat) * sampleRate));
+        for (std::size_t i = 0; i < clickSamples && start + i < song->samples.size(); ++i)
+        {
+            double t = static_cast<double>(i) / sampleRate;
+            double decay = std::exp(-t / (CLICK_SECONDS / 5.0));
+            double value = CLICK_AMPLITUDE * decay * std::sin(2.0 * M_PI * frequency * t);
+            song->samples[start + i] = static_cast<std::int16_t>(value);
+        }
+    }
+    return song;
+}
+
+float LatencyCalibration::getBeatPeriod()
+{
+    return 60.f / BPM;
+}
+
+float LatencyCalibration::getBeatTime(int beat)
+{
+    return FIRST_BEAT + beat * getBeatPeriod();
+}
+
+int LatencyCalibration::getBeatCount()
+{
+    return COUNT_IN_BEATS + MEASURED_BEATS;
+}
+
+void LatencyCalibration::reset()
+{
+    phase = CALIBRATION_AUDIO;
+    audioTaps.clear();
+    visualTaps.clear();
+    beatOffsets.assign(getBeatCount(), NAN);
+}
+
+bool LatencyCalibration::update(float time)
+{
+    if (phase == CALIBRATION_DONE || time < getBeatTime(getBeatCount() - 1) + PHASE_TAIL)
+        return false;
+
+    TimingStats &taps = phase == CALIBRATION_AUDIO ? audioTaps : visualTaps;
+    for (float offset : beatOffsets)
+        if (!std::isnan(offset))
+            taps.add(offset * 1000.0);
+    beatOffsets.assign(getBeatCount(), NAN);
+    phase = phase == CALIBRATION_AUDIO ? CALIBRATION_VISUAL : CALIBRATION_DONE;
+    return true;
+}
+
+void LatencyCalibration::tap(float time)
+{
+    if (phase == CALIBRATION_DONE)
+        return;
+    int beat = static_cast<int>(std::lround((time - FIRST_BEAT) / getBeatPeriod()));
+    if (beat < COUNT_IN_BEATS || beat >= getBeatCount())
+        return;
+    float offset = time - getBeatTime(beat);
+    if (std::isnan(beatOffsets[beat]) || std::fabs(offset) < std::fabs(beatOffsets[beat]))
+        beatOffsets[beat] = offset;
+}
+
+bool LatencyCalibration::hasEnoughTaps() const
+{
+    return audioTaps.getCount() >= MIN_TAPS && visualTaps.getCount() >= MIN_TAPS;
+}
+
+LatencyOffsets LatencyCalibration::getOffsets() const
+{
+    LatencyOffsets offsets;
+    offsets.audioMs = static_cast<float>(audioTaps.getMean());
+    offsets.visualMs = static_cast<float>(visualTaps.getMean());
+    return offsets;
+}
@@ -0,0 +1,95 @@
+#include <LevelLoader.hpp>
+
+#include <Chart.hpp>
+#include <iostream>
+
+namespace
+{
+// Versiones comprimidas que se prefieren sobre el archivo original
+const char *const COMPRESSED_EXTENSIONS[] = {".ogg", ".flac", ".mp3"};
+
+std::string findCompressed(const Assets &assets, const std::string &musicFile)
+{
+    std::string::size_type dot = musicFile.rfind('.');
+    std::string stem = musicFile.substr(0, dot);
+    for (const char *extension : COMPRESSED_EXTENSIONS)
+    {
+        if (assets.exists(stem + extension))
+            return stem + extension;
+    }
+    return musicFile;
+}
+} // namespace
+
+LevelLoader::LevelLoader(const std::array<LevelInfo, LEVEL_COUNT> &levels, const Assets &assets,
+                         SongCache &songCache, bool decodeMusic)
+    : levels(levels), assets(assets), songCache(songCache), decodeMusic(decodeMusic)
+{
+    for (auto &flag : ready)
+        flag = false;
+}
+
+LevelLoader::~LevelLoader()
+{
+    if (worker.joinable())
+        worker.join();
+}
+
+void LevelLoader::preloadAll()
+{
+    // Un nivel queda listo una sola vez (aunque falle su musica) y se reutiliza
+    // en las siguientes partidas, asi que basta con lanzar el hilo la primera vez
+    if (allReady() || worker.joinable())
+        return;
+
+    worker = std::thread([this]()
+                         {
+                             for (int i = 0; i < LEVEL_COUNT; ++i)
+                             {
+                                 if (!ready[i].load(std::memory_order_acquire))
+                                     loadLevel(i);
+                             } });
+}
+
+void LevelLoader::loadLevel(int index)
+{
+    auto level = std::make_unique<LoadedLevel>();
+
+    Chart chart;
+    level->beatsFile = levels[index].beatsFile;
+    if (assets.loadChart(chart, level->beatsFile))
+        level->notes = chart.getNotes();
+
+    // Decodifica la cancion al cache para que elegir el nivel no toque el disco
+    level->musicFile = findCompressed(assets, levels[index].musicFile);
+    if (!decodeMusic)
+    {
+        if (!assets.exists(level->musicFile))
+            std::cerr << "No se encontro " << level->musicFile << std::endl;
+    }
+    else if (!songCache.get(level->musicFile))
+        std::cerr << "Error al cargar " << level->musicFile << std::endl;
+
+    loaded[index] = std::move(level);
+    ready[index].store(true, std::memory_order_release);
+}
+
+bool LevelLoader::isReady(Difficulty difficulty) const
+{
+    return ready[difficulty].load(std::memory_order_acquire);
+}
+
+bool LevelLoader::allReady() const
+{
+    for (const auto &flag : ready)
+    {
+        if (!flag.load(std::memory_order_acquire))
+            return false;
+    }
+    return true;
+}
+
+LoadedLevel &LevelLoader::get(Difficulty difficulty)
+{
+    return *loaded[difficulty];
+}
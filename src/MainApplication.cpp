@@ -0,0 +1,803 @@
+#include <MainApplication.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+namespace
+{
+const int SAMPLE_RATE = 44100;
+
+const unsigned int TILE_LETTER_SIZE = static_cast<unsigned int>(TILE_HEIGHT * 0.6f);
+const unsigned int SCORE_TEXT_SIZE = 24;
+const unsigned int STAR_TEXT_SIZE = 28;
+const char SCORE_PREFIX[] = "Puntaje: ";
+// Lado de la estrella del HUD en pixeles (antes era el 5% de la imagen de 1024)
+const unsigned int STAR_ICON_SIZE = 51;
+
+// Tamano de buffer del sintetizador de teclas: 256 frames ~ 5.8 ms a 44100 Hz
+const std::size_t KEY_SYNTH_BUFFER_FRAMES = 256;
+
+const float FLASH_DURATION = 0.2f;
+
+// Archivo con las latencias medidas, junto al ejecutable
+const char LATENCY_FILE[] = "latencia.txt";
+// Velocidad de los tiles de la fase visual de la calibracion (la de MEDIUM)
+const float CALIBRATION_TILE_SPEED = 250.f;
+
+// Imagenes de la interfaz, en el orden en que se piden a UiTextures
+enum UiImage
+{
+    IMAGE_MENU_BACKGROUND,
+    IMAGE_STAR,
+    IMAGE_CONGRATS
+};
+
+std::string describeLatency(const char *name, const TimingStats &taps)
+{
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "%s: %+.1f ms (jitter %.1f ms, %zu toques)", name, taps.getMean(),
+                  taps.getStdDev(), taps.getCount());
+    return buffer;
+}
+
+void centerOrigin(sf::Text &text)
+{
+    sf::FloatRect bounds = text.getLocalBounds();
+    text.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+}
+
+std::string describeSongCache(const SongCacheStats &stats)
+{
+    return "cache de canciones: " + std::to_string(stats.hits) + " aciertos, " + std::to_string(stats.misses) +
+           " fallos, " + std::to_string(stats.evictions) + " desalojos, " + std::to_string(stats.songs) +
+           " canciones (" + std::to_string(stats.bytes / (1024 * 1024)) + " MB)";
+}
+
+std::string describeStreaming(const StreamingStats &stats)
+{
+    char text[128];
+    std::snprintf(text, sizeof(text), "streaming: %zu faltantes, %.1f ms de espera, minimo %.0f ms en buffer",
+                  stats.underruns, stats.stallMs, stats.minBufferedMs);
+    return text;
+}
+
+// Con los eventos de la ventana el desfase incluye el redondeo al cuadro
+std::string describeHits(const TimingStats &offsets, bool sampled)
+{
+    return std::string(sampled ? "golpes: " : "golpes (redondeados al cuadro): ") + offsets.describe();
+}
+
+std::string describeSampler(const SamplerStats &stats)
+{
+    char line[128];
+    std::snprintf(line, sizeof(line), "entrada: %llu lecturas, periodo %.3f ms, jitter %.3f ms, max %.3f ms",
+                  static_cast<unsigned long long>(stats.samples), stats.meanMs, stats.jitterMs, stats.maxMs);
+    return line;
+}
+}
+
+// Todo se busca junto al ejecutable, sin depender del directorio actual.
+// Sin assets.pak se usan los archivos sueltos. Las imagenes se decodifican y
+// reescalan al tamano en pantalla en otros hilos mientras se crea la ventana;
+// la estrella va en el atlas.
+MainApplication::MainApplication(const Options &options, const char *argv0)
+    : options(options),
+      exeDir(Assets::getExecutableDir(argv0)),
+      assets(exeDir),
+      usingPack(assets.openPack(exeDir + "assets.pak")),
+      uiTextures(assets, {{"assets/images/menu_background.png", {SCREEN_WIDTH, SCREEN_HEIGHT}, false},
+                          {"assets/images/estrella.png", {STAR_ICON_SIZE, STAR_ICON_SIZE}, true},
+                          {"assets/images/congrats.png", {SCREEN_WIDTH, SCREEN_HEIGHT}, false}}),
+      keySynth(KEY_SYNTH_BUFFER_FRAMES, SAMPLE_RATE),
+      tileRenderer(glyphAtlas, {COLUMN_WIDTH - 2.f, TILE_HEIGHT}, TILE_LETTER_SIZE),
+      songCache(assets, options.songCacheMb * 1024 * 1024, options.songCachePolicy),
+      levelLoader({{
+          {"assets/beats/beats easy.chart", "assets/sounds/easy_song.WAV"},  // EASY
+          {"assets/beats/beats.chart", "assets/sounds/medium_song.WAV"},    // MEDIUM
+          {"assets/beats/hard_beats.chart", "assets/sounds/hard_song.WAV"}, // HARD
+      }}, assets, songCache, !options.streamMusic),
+      latencyPath(exeDir + LATENCY_FILE),
+      keyFlashTimers(NUM_COLUMNS, 0.f)
+{
+}
+
+bool MainApplication::init()
+{
+    if (!options.replayPath.empty())
+    {
+        if (!replay.loadFromFile(options.replayPath))
+        {
+            std::cerr << "Error: no se pudo leer la repeticion " << options.replayPath << std::endl;
+            return false;
+        }
+        replayPending = true;
+    }
+    if (usingPack)
+        std::cout << "Usando assets.pak (" << assets.getPack().getEntryCount() << " archivos)" << std::endl;
+
+    srand(static_cast<unsigned int>(time(nullptr)));
+    window.create(sf::VideoMode(SCREEN_WIDTH, SCREEN_HEIGHT), "Piano Tiles Avanzado");
+    window.setVerticalSyncEnabled(options.vsync);
+    window.setFramerateLimit(options.fpsLimit);
+
+    keySynth.play();
+
+    if (latency.loadFromFile(latencyPath))
+    {
+        songClock.setLatency(latency.audioMs / 1000.f, latency.visualMs / 1000.f);
+        std::cout << "Latencia: audio " << latency.audioMs << " ms, video " << latency.visualMs << " ms" << std::endl;
+    }
+
+    difficulties = makeDifficulties();
+
+    if (!assets.loadFont(font, "assets/Orbitron-Regular.ttf"))
+    {
+        std::cerr << "Error: No se pudo cargar la fuente 'Bangers-Regular.ttf'." << std::endl;
+        return false;
+    }
+    starSprite.setPosition(SCREEN_WIDTH - 70.f, 10.f);
+
+    // Letras de los carriles y textos del HUD, rasterizados una vez en el atlas
+    std::string laneLetters(CurrentLayout::LETTERS.begin(), CurrentLayout::LETTERS.end());
+    if (!glyphAtlas.build(font, {{TILE_LETTER_SIZE, laneLetters},
+                                 {SCORE_TEXT_SIZE, SCORE_PREFIX + std::string("0123456789")},
+                                 {STAR_TEXT_SIZE, "x0123456789"}}))
+    {
+        std::cerr << "Error al crear el atlas de glifos." << std::endl;
+        return false;
+    }
+
+    if (options.inputHz > 0.f)
+    {
+        inputSampler.reset(new InputSampler(CurrentKeys::KEYS, options.inputHz));
+        inputSampler->setEnabled(window.hasFocus());
+    }
+
+    startText = sf::Text("PRESIONA ENTER PARA INCIAR", font, 35);
+    centerOrigin(startText);
+    startText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f);
+
+    // La pantalla de inicio solo necesita el fondo; las demas imagenes se
+    // suben en el ciclo principal conforme terminan de decodificarse
+    if (!uiTextures.wait(IMAGE_MENU_BACKGROUND))
+    {
+        std::cerr << "Error al cargar la imagen de fondo del menú." << std::endl;
+        return false;
+    }
+    uiTextures.applyTo(IMAGE_MENU_BACKGROUND, menuBackgroundSprite);
+
+    titleText = sf::Text("KeysRush", font, 55);
+    centerOrigin(titleText);
+    titleText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 4.f);
+
+    promptText = sf::Text("Selecciona tu nivel:", font, 30);
+    centerOrigin(promptText);
+    promptText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f - 20);
+
+    subtitleText = sf::Text("(presiona el numero que deseas)", font, 20);
+    centerOrigin(subtitleText);
+    subtitleText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 20);
+
+    easyText = sf::Text("1. Lets Ride Away (Avicci)", font, 25);
+    centerOrigin(easyText);
+    easyText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 55);
+
+    mediumText = sf::Text("2. Arsonist (NOME)", font, 25);
+    centerOrigin(mediumText);
+    mediumText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 95);
+
+    hardText = sf::Text("3. Tremor (Martin garrix)", font, 25);
+    centerOrigin(hardText);
+    hardText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 135);
+
+    loadingText = sf::Text("", font, 18);
+    loadingText.setFillColor(sf::Color(200, 200, 200));
+    loadingText.setPosition(10.f, SCREEN_HEIGHT - 30.f);
+
+    gameOverText = sf::Text("FIN DEL JUEGO", font, 50);
+    gameOverText.setFillColor(sf::Color::Red);
+    centerOrigin(gameOverText);
+    gameOverText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f);
+
+    restartText = sf::Text("Presiona 'R' para volver al menu", font, 20);
+    centerOrigin(restartText);
+    restartText.setPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 50.f);
+
+    calibrationText = sf::Text("", font, 20);
+    calibrationText.setPosition(20.f, 20.f);
+
+    targetZone.setSize(sf::Vector2f(static_cast<float>(SCREEN_WIDTH), TILE_HEIGHT / 2));
+    targetZone.setFillColor(sf::Color(255, 255, 255, 50));
+    targetZone.setPosition(0.f, SCREEN_HEIGHT - TILE_HEIGHT * 1.5f);
+
+    for (int i = 0; i < NUM_COLUMNS - 1; ++i)
+    {
+        columnLines.append(sf::Vertex(sf::Vector2f(COLUMN_WIDTH * (i + 1), 0.f), sf::Color(100, 100, 100)));
+        columnLines.append(sf::Vertex(sf::Vector2f(COLUMN_WIDTH * (i + 1), static_cast<float>(SCREEN_HEIGHT)), sf::Color(100, 100, 100)));
+    }
+
+    playfieldCached = playfieldTexture.create(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (playfieldCached)
+    {
+        playfieldTexture.clear(sf::Color(50, 50, 70));
+        playfieldTexture.draw(menuBackgroundSprite);
+        playfieldTexture.draw(columnLines);
+        playfieldTexture.draw(targetZone);
+        playfieldTexture.display();
+        playfieldSprite.setTexture(playfieldTexture.getTexture());
+    }
+
+    if (!options.tracePath.empty() && !profiler.openTrace(options.tracePath))
+        std::cerr << "Error al crear " << options.tracePath << std::endl;
+    profilerText = sf::Text("", font, 12);
+    profilerText.setFillColor(sf::Color(120, 255, 120));
+    profilerText.setPosition(10.f, 45.f);
+
+    // Con --replay se salta el menu y arranca el nivel grabado
+    if (replayPending)
+    {
+        currentDifficulty = replay.getDifficulty();
+        currentState = SHOWING_MENU;
+        levelLoader.preloadAll();
+        levelRequested = true;
+    }
+    else if (options.calibrate)
+    {
+        startCalibration();
+    }
+    return true;
+}
+
+int MainApplication::run()
+{
+    if (!init())
+        return 1;
+
+    while (window.isOpen())
+    {
+        profiler.beginPhase(PHASE_EVENTS);
+        if (uiTextures.update())
+        {
+            uiTextures.applyTo(IMAGE_STAR, starSprite);
+            uiTextures.applyTo(IMAGE_CONGRATS, congratsSprite);
+        }
+        float dt = clock.restart().asSeconds();
+        processEvents();
+        pollInput();
+
+        profiler.beginPhase(PHASE_SIMULATION);
+        startRequestedLevel();
+        if (currentState == PLAYING)
+            updatePlaying(dt);
+        else if (currentState == CALIBRATING)
+            updateCalibration(dt);
+
+        // El resumen del profiler se arma cada 15 cuadros para que no pese
+        if (showProfiler && frameCount % 15 == 0)
+        {
+            profiler.beginPhase(PHASE_HUD);
+            std::string summary = profiler.getSummary() + "\n" + describeSongCache(songCache.getStats());
+            if (options.streamMusic)
+                summary += "\n" + describeStreaming(streamingMusic.getStats());
+            if (options.inputStats)
+            {
+                summary += "\n" + describeHits(hitOffsets, inputSampler != nullptr);
+                if (inputSampler)
+                    summary += "\n" + describeSampler(inputSampler->getStats());
+            }
+            profilerText.setString(summary);
+        }
+
+        profiler.beginPhase(PHASE_TILE_BATCH);
+        buildTiles();
+
+        profiler.beginPhase(PHASE_DRAW);
+        render();
+
+        profiler.beginPhase(PHASE_DISPLAY);
+        window.display();
+        bool tilesVisible = currentState == PLAYING || currentState == GAME_OVER;
+        profiler.endFrame(drawCalls, tilesVisible ? tileRenderer.getTileCount() : 0);
+        ++frameCount;
+    }
+
+    // Una partida que se corta al cerrar el juego tambien se graba
+    if (currentState == PLAYING && !sessionReported)
+    {
+        session.finish();
+        reportSession();
+    }
+    printStats();
+    return 0;
+}
+
+void MainApplication::processEvents()
+{
+    sf::Event event;
+    while (window.pollEvent(event))
+        handleEvent(event);
+}
+
+void MainApplication::handleEvent(const sf::Event &event)
+{
+    if (event.type == sf::Event::Closed)
+    {
+        window.close();
+    }
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
+    {
+        showProfiler = !showProfiler;
+    }
+    if (inputSampler && (event.type == sf::Event::LostFocus || event.type == sf::Event::GainedFocus))
+    {
+        inputSampler->setEnabled(event.type == sf::Event::GainedFocus);
+    }
+    if (currentState == SHOWING_START)
+    {
+        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Enter)
+        {
+            currentState = SHOWING_MENU;
+            levelLoader.preloadAll();
+        }
+        return;
+    }
+
+    switch (currentState)
+    {
+    case SHOWING_MENU:
+    {
+        bool selectionMade = false;
+        if (event.type == sf::Event::KeyPressed)
+        {
+            if (event.key.code == sf::Keyboard::Num1)
+            {
+                currentDifficulty = EASY;
+                selectionMade = true;
+            }
+            else if (event.key.code == sf::Keyboard::Num2)
+            {
+                currentDifficulty = MEDIUM;
+                selectionMade = true;
+            }
+            else if (event.key.code == sf::Keyboard::Num3)
+            {
+                currentDifficulty = HARD;
+                selectionMade = true;
+            }
+
+            if (selectionMade)
+            {
+                // El nivel se arranca cuando el cargador lo tenga listo
+                levelRequested = true;
+            }
+        }
+        break;
+    }
+    case PLAYING:
+    {
+        // Sin hilo de entrada el timestamp es el momento en que se lee el
+        // evento, al inicio del cuadro: queda redondeado al cuadro (hasta
+        // 16 ms tarde con vsync a 60 Hz)
+        if (!inputSampler && !session.isPlayback() && event.type == sf::Event::KeyPressed)
+        {
+            int column = CurrentKeys::laneForKey(event.key.code);
+            if (column >= 0)
+                presses.push_back({column, std::chrono::steady_clock::now()});
+        }
+        break;
+    }
+    case CALIBRATING:
+    {
+        if (event.type != sf::Event::KeyPressed)
+            break;
+        if (calibration.getPhase() == CALIBRATION_DONE)
+        {
+            if (event.key.code == sf::Keyboard::Enter)
+            {
+                currentState = SHOWING_MENU;
+                levelLoader.preloadAll();
+            }
+        }
+        else if (!inputSampler)
+        {
+            int column = CurrentKeys::laneForKey(event.key.code);
+            if (column >= 0)
+                presses.push_back({column, std::chrono::steady_clock::now()});
+        }
+        break;
+    }
+    case GAME_OVER:
+    {
+        if (music && music->getStatus() == sf::SoundStream::Playing)
+        {
+            music->stop();
+        }
+        if (event.type == sf::Event::KeyPressed)
+        {
+            if (event.key.code == sf::Keyboard::R)
+            {
+                currentState = SHOWING_MENU;
+                levelLoader.preloadAll();
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void MainApplication::pollInput()
+{
+    if (!inputSampler)
+        return;
+    // Lo que se presiono fuera de una partida o de la calibracion (o durante
+    // una repeticion) se descarta
+    LanePress press;
+    while (inputSampler->poll(press))
+        if ((currentState == PLAYING && !session.isPlayback()) || currentState == CALIBRATING)
+            presses.push_back(press);
+}
+
+void MainApplication::startRequestedLevel()
+{
+    if (currentState != SHOWING_MENU || !levelRequested || !levelLoader.isReady(currentDifficulty))
+        return;
+
+    levelRequested = false;
+    LoadedLevel &level = levelLoader.get(currentDifficulty);
+    starsEarned = 0;
+    if (replayPending)
+    {
+        if (level.beatsFile != replay.getChartFile())
+            std::cerr << "Aviso: la repeticion se grabo con " << replay.getChartFile() << std::endl;
+        session.startPlayback(difficulties[currentDifficulty], level.notes, replay);
+        replayPending = false;
+    }
+    else
+    {
+        session.start(difficulties[currentDifficulty], level.notes, currentDifficulty, level.beatsFile,
+                      static_cast<unsigned int>(rand()), options.simulationHz);
+    }
+    sessionReported = false;
+    if (options.streamMusic)
+    {
+        music = streamingMusic.open(assets, level.musicFile) ? &streamingMusic : nullptr;
+    }
+    else
+    {
+        // Normalmente ya esta en el cache; si se saco, se decodifica aqui
+        std::shared_ptr<const DecodedSong> song = songCache.get(level.musicFile);
+        songStream.setSong(song);
+        music = song ? &songStream : nullptr;
+    }
+    if (music)
+        music->play();
+    songClock.reset();
+    presses.clear();
+    currentState = PLAYING;
+}
+
+void MainApplication::updatePlaying(float dt)
+{
+    const Simulation &simulation = session.getSimulation();
+    bool musicPlaying = music && music->getStatus() == sf::SoundStream::Playing;
+    bool musicStopped = !music || music->getStatus() == sf::SoundStream::Stopped;
+    float songTime = songClock.update(music ? music->getPlayingOffset().asSeconds() : 0.f, musicPlaying);
+
+    // Los golpes se juzgan antes de avanzar la simulacion, cada uno en el
+    // tiempo de la cancion en que ocurrio
+    for (const LanePress &press : presses)
+    {
+        if (simulation.getState() != PLAYING)
+            break;
+        keyFlashTimers[press.column] = FLASH_DURATION;
+        keySynth.trigger(CurrentLayout::PITCHES[press.column]);
+        if (session.press(press.column, songClock.timeAt(press.time)) != MISS && options.inputStats)
+            hitOffsets.add(simulation.getLastOffset() * 1000.f);
+    }
+    presses.clear();
+
+    // La simulacion avanza en pasos fijos hasta alcanzar el reloj de la
+    // cancion, sin importar cuanto duro el cuadro
+    session.advance(songTime, musicStopped);
+    for (int column : session.getPlaybackPresses())
+    {
+        keyFlashTimers[column] = FLASH_DURATION;
+        keySynth.trigger(CurrentLayout::PITCHES[column]);
+    }
+    starsEarned = std::max(starsEarned, simulation.getStarsEarned());
+
+    currentState = simulation.getState();
+    if (session.isFinished())
+    {
+        // Una repeticion que se grabo hasta cerrar el juego termina aqui
+        if (currentState == PLAYING)
+            currentState = GAME_OVER;
+        if (currentState == GAME_OVER && music)
+            music->stop();
+        if (!sessionReported)
+            reportSession();
+    }
+
+    profiler.beginPhase(PHASE_HUD);
+    updateHud();
+    updateKeyFlashes(dt);
+}
+
+void MainApplication::updateKeyFlashes(float dt)
+{
+    for (auto &timer : keyFlashTimers)
+    {
+        if (timer > 0.f)
+            timer -= dt;
+    }
+}
+
+void MainApplication::startCalibration()
+{
+    // Se mide sin las latencias guardadas y con el metronomo sonando por el
+    // mismo stream y el mismo reloj que las canciones
+    songClock.setLatency(0.f, 0.f);
+    calibration.reset();
+    songStream.setSong(LatencyCalibration::makeMetronome(SAMPLE_RATE));
+    music = &songStream;
+    music->play();
+    songClock.reset();
+    presses.clear();
+    calibrationText.setString("CALIBRACION 1/2: toca una tecla de carril con cada clic,\n"
+                              "sin mirar la pantalla");
+    currentState = CALIBRATING;
+}
+
+void MainApplication::updateCalibration(float dt)
+{
+    bool musicPlaying = music && music->getStatus() == sf::SoundStream::Playing;
+    float time = songClock.update(music ? music->getPlayingOffset().asSeconds() : 0.f, musicPlaying);
+    for (const LanePress &press : presses)
+    {
+        keyFlashTimers[press.column] = FLASH_DURATION;
+        calibration.tap(songClock.timeAt(press.time));
+    }
+    presses.clear();
+    updateKeyFlashes(dt);
+
+    if (!calibration.update(time))
+        return;
+    if (calibration.getPhase() == CALIBRATION_VISUAL)
+    {
+        // La fase visual va sin sonido; el reloj sigue solo con el tiempo real
+        music->stop();
+        music = nullptr;
+        songClock.reset();
+        calibrationText.setString("CALIBRACION 2/2: toca una tecla de carril cuando\n"
+                                  "cada fila de tiles llegue a la zona");
+    }
+    else
+    {
+        finishCalibration();
+    }
+}
+
+void MainApplication::finishCalibration()
+{
+    std::string audio = describeLatency("Audio", calibration.getAudioStats());
+    std::string visual = describeLatency("Video", calibration.getVisualStats());
+    std::cout << "Calibracion:\n  " << audio << "\n  " << visual << std::endl;
+
+    std::string result;
+    if (calibration.hasEnoughTaps())
+    {
+        latency = calibration.getOffsets();
+        if (latency.saveToFile(latencyPath))
+            std::cout << "Latencia guardada en " << latencyPath << std::endl;
+        else
+            std::cerr << "Error al escribir " << latencyPath << std::endl;
+        result = audio + "\n" + visual;
+    }
+    else
+    {
+        result = "Muy pocos toques; se conserva la latencia anterior";
+    }
+    // Con o sin medicion nueva, las partidas usan la latencia vigente
+    songClock.setLatency(latency.audioMs / 1000.f, latency.visualMs / 1000.f);
+    calibrationText.setString(result + "\n\nPresiona ENTER para ir al menu");
+}
+
+void MainApplication::updateHud()
+{
+    // El HUD solo se vuelve a armar cuando cambia el puntaje o las estrellas
+    int score = session.getSimulation().getScore();
+    if (score == hudScore && starsEarned == hudStars)
+        return;
+    hudScore = score;
+    hudStars = starsEarned;
+    hudQuads.clear();
+    glyphAtlas.appendText(hudQuads, SCORE_TEXT_SIZE, SCORE_PREFIX + std::to_string(hudScore), {10.f, 10.f},
+                          sf::Color::White);
+    if (hudStars > 1)
+        glyphAtlas.appendText(hudQuads, STAR_TEXT_SIZE, "x" + std::to_string(hudStars),
+                              {SCREEN_WIDTH - 130.f, 10.f}, sf::Color::Yellow);
+}
+
+void MainApplication::buildTiles()
+{
+    if (currentState == CALIBRATING)
+    {
+        // En la fase visual una fila de tiles llega a la zona en cada tiempo
+        tileRenderer.clear();
+        if (calibration.getPhase() != CALIBRATION_VISUAL)
+            return;
+        float time = songClock.getTime();
+        for (int beat = 0; beat < LatencyCalibration::getBeatCount(); ++beat)
+        {
+            float y = HIT_LINE_Y - (LatencyCalibration::getBeatTime(beat) - time) * CALIBRATION_TILE_SPEED;
+            if (y < -TILE_HEIGHT || y > SCREEN_HEIGHT)
+                continue;
+            for (int column = 0; column < NUM_COLUMNS; ++column)
+                tileRenderer.addTile({COLUMN_WIDTH * column + 1.f, y}, CurrentLayout::LETTERS[column]);
+        }
+        return;
+    }
+    if (currentState != PLAYING && currentState != GAME_OVER)
+        return;
+
+    // Entre dos pasos de simulacion los tiles se dibujan interpolados al
+    // tiempo actual de la cancion (el movimiento es lineal en el tiempo), y
+    // adelantados la latencia visual medida
+    const Simulation &simulation = session.getSimulation();
+    float renderTime = simulation.getTime();
+    if (currentState == PLAYING)
+        renderTime = std::min(songClock.getTime(), session.getSimTime() + session.getSimStep()) +
+                     songClock.getVisualLatency();
+    tileRenderer.clear();
+    const TilePool &tiles = simulation.getTiles();
+    for (std::size_t i = 0; i < tiles.size(); ++i)
+    {
+        std::size_t slot = tiles.slotAt(i);
+        if (!tiles.isActive(slot))
+            continue;
+        int column = tiles.getColumn(slot);
+        tileRenderer.addTile({COLUMN_WIDTH * column + 1.f, simulation.getTileY(slot, renderTime)},
+                             CurrentLayout::LETTERS[column]);
+    }
+}
+
+void MainApplication::draw(const sf::Drawable &drawable)
+{
+    window.draw(drawable);
+    ++drawCalls;
+}
+
+void MainApplication::drawPlayfield()
+{
+    if (playfieldCached)
+    {
+        draw(playfieldSprite);
+        return;
+    }
+    draw(menuBackgroundSprite);
+    draw(columnLines);
+    draw(targetZone);
+}
+
+void MainApplication::drawKeyFlashes()
+{
+    flashQuads.clear();
+    for (int i = 0; i < NUM_COLUMNS; ++i)
+    {
+        if (keyFlashTimers[i] > 0.f)
+        {
+            float left = i * COLUMN_WIDTH + 1.f;
+            float right = left + COLUMN_WIDTH - 2.f;
+            sf::Color color(255, 255, 100, static_cast<sf::Uint8>(200 * (keyFlashTimers[i] / FLASH_DURATION)));
+            flashQuads.append(sf::Vertex({left, 0.f}, color));
+            flashQuads.append(sf::Vertex({right, 0.f}, color));
+            flashQuads.append(sf::Vertex({right, static_cast<float>(SCREEN_HEIGHT)}, color));
+            flashQuads.append(sf::Vertex({left, static_cast<float>(SCREEN_HEIGHT)}, color));
+        }
+    }
+    if (flashQuads.getVertexCount() > 0)
+        draw(flashQuads);
+}
+
+void MainApplication::render()
+{
+    drawCalls = 0;
+    window.clear(sf::Color(50, 50, 70));
+    switch (currentState)
+    {
+    case SHOWING_START:
+        draw(menuBackgroundSprite);
+        draw(startText);
+        break;
+
+    case SHOWING_MENU:
+        draw(menuBackgroundSprite);
+        draw(titleText);
+        draw(subtitleText);
+        draw(promptText);
+        draw(easyText);
+        draw(mediumText);
+        draw(hardText);
+        if (levelRequested || !levelLoader.allReady())
+        {
+            loadingText.setString(levelRequested ? "Cargando nivel..." : "Cargando niveles...");
+            draw(loadingText);
+        }
+        break;
+
+    case PLAYING:
+        drawPlayfield();
+        drawKeyFlashes();
+        drawCalls += tileRenderer.draw(window);
+        window.draw(hudQuads, &glyphAtlas.getTexture());
+        ++drawCalls;
+        if (starsEarned >= 1)
+            draw(starSprite);
+        break;
+
+    case GAME_OVER:
+        drawPlayfield();
+        drawCalls += tileRenderer.draw(window);
+        window.draw(hudQuads, &glyphAtlas.getTexture());
+        ++drawCalls;
+        if (starsEarned >= 1)
+            draw(starSprite);
+        draw(gameOverText);
+        draw(restartText);
+        break;
+
+    case GAME_WIN:
+        draw(menuBackgroundSprite);
+        draw(congratsSprite);
+        break;
+
+    case CALIBRATING:
+        drawPlayfield();
+        drawKeyFlashes();
+        drawCalls += tileRenderer.draw(window);
+        draw(calibrationText);
+        break;
+    }
+
+    if (showProfiler)
+        draw(profilerText);
+}
+
+void MainApplication::reportSession()
+{
+    sessionReported = true;
+    ReplayResult result = session.getResult();
+    if (session.isPlayback())
+    {
+        std::cout << "Repeticion " << (session.matchesRecording() ? "identica" : "DIFERENTE") << ": puntaje "
+                  << result.score << " en " << result.stepCount << " pasos (grabado "
+                  << replay.getResult().score << " en " << replay.getResult().stepCount << ")" << std::endl;
+    }
+    else if (!options.recordPath.empty())
+    {
+        if (session.getRecording().saveToFile(options.recordPath))
+            std::cout << "Partida grabada en " << options.recordPath << " ("
+                      << session.getRecording().getPressCount() << " golpes)" << std::endl;
+        else
+            std::cerr << "Error al escribir " << options.recordPath << std::endl;
+    }
+}
+
+void MainApplication::printStats() const
+{
+    std::cout << describeSongCache(songCache.getStats()) << std::endl;
+    if (options.streamMusic)
+        std::cout << describeStreaming(streamingMusic.getStats()) << std::endl;
+    if (options.inputStats)
+    {
+        std::cout << describeHits(hitOffsets, inputSampler != nullptr) << std::endl;
+        if (inputSampler)
+            std::cout << describeSampler(inputSampler->getStats()) << std::endl;
+    }
+}
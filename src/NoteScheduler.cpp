@@ -0,0 +1,13 @@
+#include <NoteScheduler.hpp>
+
+#include <algorithm>
+
+void NoteScheduler::reset(const std::vector<Nota> &newNotes)
+{
+    notes = newNotes;
+    auto byTime = [](const Nota &a, const Nota &b)
+    { return a.tiempo < b.tiempo; };
+    if (!std::is_sorted(notes.begin(), notes.end(), byTime))
+        std::stable_sort(notes.begin(), notes.end(), byTime);
+    cursor = 0;
+}
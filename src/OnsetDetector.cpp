@@ -0,0 +1,171 @@
+#include <OnsetDetector.hpp>
+
+#include <Fft.hpp>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+// Compresion del espectro antes de comparar ventanas: resalta los golpes
+// suaves frente a los fuertes
+const float LOG_COMPRESSION = 100.f;
+// Ventanas a cada lado para el maximo local y para el promedio del umbral
+const std::size_t PEAK_RADIUS = 3;
+const std::size_t MEAN_RADIUS = 16;
+} // namespace
+
+OnsetDetector::OnsetDetector(const OnsetSettings &newSettings) : settings(newSettings)
+{
+    // Ventana de Hann
+    const double pi = 3.14159265358979323846;
+    window.resize(settings.frameSize);
+    for (std::size_t i = 0; i < settings.frameSize; ++i)
+        window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * pi * i / settings.frameSize));
+}
+
+float OnsetDetector::frameTime(std::size_t frame) const
+{
+    // El flujo crece mientras el golpe entra a la ventana y llega a su pico
+    // cerca de un salto antes de que el golpe pase por el centro
+    return static_cast<float>(frame * hop + settings.frameSize / 2 + hop) / sampleRate;
+}
+
+void OnsetDetector::analyze(const float *samples, std::size_t count, unsigned int newSampleRate)
+{
+    sampleRate = newSampleRate;
+    hop = std::max<std::size_t>(1, static_cast<std::size_t>(sampleRate / settings.framesPerSecond));
+    std::size_t frames = count < settings.frameSize ? 0 : (count - settings.frameSize) / hop + 1;
+    flux.assign(frames, 0.f);
+    centroids.assign(frames, 0.f);
+
+    unsigned int threads = settings.threads ? settings.threads : std::max(1u, std::thread::hardware_concurrency());
+    // Con bloques de menos de 64 ventanas no vale la pena otro hilo
+    threads = static_cast<unsigned int>(std::max<std::size_t>(1, std::min<std::size_t>(threads, frames / 64)));
+    threadsUsed = threads;
+
+    std::vector<std::thread> workers;
+    std::size_t chunk = (frames + threads - 1) / threads;
+    for (unsigned int t = 1; t < threads; ++t)
+    {
+        std::size_t begin = std::min(frames, t * chunk);
+        std::size_t end = std::min(frames, begin + chunk);
+        workers.emplace_back([this, samples, begin, end]()
+                             { analyzeRange(samples, begin, end); });
+    }
+    analyzeRange(samples, 0, std::min(frames, chunk));
+    for (auto &worker : workers)
+        worker.join();
+}
+
+void OnsetDetector::analyzeRange(const float *samples, std::size_t begin, std::size_t end)
+{
+    if (begin >= end)
+        return;
+
+    const std::size_t size = settings.frameSize;
+    const std::size_t bins = size / 2;
+    Fft fft(size);
+    std::vector<float> re(size), im(size);
+    std::vector<float> previous(bins), current(bins);
+    const float binHz = static_cast<float>(sampleRate) / size;
+
+    auto spectrum = [&](std::size_t frame, float *__restrict magnitude)
+    {
+        const float *__restrict input = samples + frame * hop;
+        const float *__restrict w = window.data();
+        float *__restrict r = re.data();
+        float *__restrict i = im.data();
+        for (std::size_t k = 0; k < size; ++k)
+        {
+            r[k] = input[k] * w[k];
+            i[k] = 0.f;
+        }
+        fft.forward(r, i);
+        for (std::size_t k = 0; k < bins; ++k)
+            magnitude[k] = std::log1p(LOG_COMPRESSION * std::sqrt(r[k] * r[k] + i[k] * i[k]));
+    };
+
+    // La primera ventana del bloque se compara contra la ultima del bloque
+    // anterior, que se recalcula aqui
+    if (begin > 0)
+        spectrum(begin - 1, previous.data());
+    else
+        spectrum(0, previous.data());
+
+    for (std::size_t frame = begin; frame < end; ++frame)
+    {
+        spectrum(frame, current.data());
+
+        const float *__restrict cur = current.data();
+        const float *__restrict prev = previous.data();
+        float rise = 0.f;
+        float weighted = 0.f;
+        float total = 0.f;
+        for (std::size_t k = 0; k < bins; ++k)
+        {
+            float diff = cur[k] - prev[k];
+            rise += diff > 0.f ? diff : 0.f;
+            weighted += cur[k] * static_cast<float>(k);
+            total += cur[k];
+        }
+        flux[frame] = rise;
+        centroids[frame] = total > 0.f ? weighted / total * binHz : 0.f;
+        previous.swap(current);
+    }
+}
+
+std::vector<Onset> OnsetDetector::pickOnsets(float delta, float minGap) const
+{
+    std::vector<Onset> onsets;
+    const std::size_t frames = flux.size();
+    if (frames == 0)
+        return onsets;
+
+    // Normaliza el flujo para que 'delta' no dependa del volumen de la pista
+    double sum = 0.0, sumSquares = 0.0;
+    for (float value : flux)
+    {
+        sum += value;
+        sumSquares += static_cast<double>(value) * value;
+    }
+    double mean = sum / frames;
+    double deviation = std::sqrt(std::max(0.0, sumSquares / frames - mean * mean));
+    if (deviation <= 0.0)
+        return onsets;
+    std::vector<float> normalized(frames);
+    for (std::size_t i = 0; i < frames; ++i)
+        normalized[i] = static_cast<float>((flux[i] - mean) / deviation);
+
+    // Sumas prefijo para sacar el promedio local en O(1)
+    std::vector<double> prefix(frames + 1, 0.0);
+    for (std::size_t i = 0; i < frames; ++i)
+        prefix[i + 1] = prefix[i] + normalized[i];
+
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        std::size_t peakBegin = i > PEAK_RADIUS ? i - PEAK_RADIUS : 0;
+        std::size_t peakEnd = std::min(frames, i + PEAK_RADIUS + 1);
+        if (*std::max_element(normalized.begin() + peakBegin, normalized.begin() + peakEnd) != normalized[i])
+            continue;
+
+        std::size_t meanBegin = i > MEAN_RADIUS ? i - MEAN_RADIUS : 0;
+        std::size_t meanEnd = std::min(frames, i + MEAN_RADIUS + 1);
+        // En tramos silenciosos el promedio local queda por debajo del global;
+        // ahi manda el global para que el ruido no cuente como golpe
+        double localMean = std::max(0.0, (prefix[meanEnd] - prefix[meanBegin]) / (meanEnd - meanBegin));
+        if (normalized[i] < localMean + delta)
+            continue;
+
+        // Dos golpes demasiado juntos: se queda el mas fuerte
+        Onset onset = {frameTime(i), normalized[i], centroids[i]};
+        if (!onsets.empty() && onset.time - onsets.back().time < minGap)
+        {
+            if (onset.strength > onsets.back().strength)
+                onsets.back() = onset;
+            continue;
+        }
+        onsets.push_back(onset);
+    }
+    return onsets;
+}
@@ -0,0 +1,118 @@
+#include <Options.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+void printUsage(const char *program)
+{
+    std::cerr << "Uso: " << program << " [opciones]\n"
+              << "  --vsync          sincroniza con el monitor (por defecto)\n"
+              << "  --fps N          limita a N cuadros por segundo, sin vsync\n"
+              << "  --uncapped       sin vsync ni limite de cuadros\n"
+              << "  --sim-hz N       frecuencia fija de la simulacion (por defecto 240)\n"
+              << "  --trace f.csv    escribe los tiempos de cada fase por cuadro en un CSV\n"
+              << "  --song-cache N   megabytes para canciones decodificadas (por defecto 128)\n"
+              << "  --song-cache-policy lru|fifo\n"
+              << "                   cual cancion se saca cuando el cache se llena\n"
+              << "  --input-hz N     lee las teclas en un hilo a N Hz (por defecto 1000 en\n"
+              << "                   Windows; en los demas 0 = eventos de la ventana)\n"
+              << "  --input-stats    reporta el desfase de los golpes y el jitter de la entrada\n"
+              << "  --record f.replay  graba la entrada de la ultima partida\n"
+              << "  --replay f.replay  reproduce una partida grabada en tiempo real\n"
+              << "  --calibrate      mide la latencia de audio y video con un metronomo\n"
+              << "  --stream-music   decodifica la cancion en un hilo mientras suena, sin\n"
+              << "                   tenerla completa en memoria\n";
+}
+}
+
+bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--vsync")
+        {
+            options.vsync = true;
+            options.fpsLimit = 0;
+        }
+        else if (arg == "--fps" && hasValue)
+        {
+            options.vsync = false;
+            options.fpsLimit = static_cast<unsigned int>(std::atoi(argv[++i]));
+        }
+        else if (arg == "--uncapped")
+        {
+            options.vsync = false;
+            options.fpsLimit = 0;
+        }
+        else if (arg == "--sim-hz" && hasValue)
+        {
+            options.simulationHz = static_cast<float>(std::atof(argv[++i]));
+            if (options.simulationHz <= 0.f)
+            {
+                printUsage(argv[0]);
+                return false;
+            }
+        }
+        else if (arg == "--trace" && hasValue)
+        {
+            options.tracePath = argv[++i];
+        }
+        else if (arg == "--song-cache" && hasValue)
+        {
+            options.songCacheMb = static_cast<std::size_t>(std::atoi(argv[++i]));
+        }
+        else if (arg == "--input-hz" && hasValue)
+        {
+            options.inputHz = static_cast<float>(std::atof(argv[++i]));
+            if (options.inputHz < 0.f)
+            {
+                printUsage(argv[0]);
+                return false;
+            }
+        }
+        else if (arg == "--input-stats")
+        {
+            options.inputStats = true;
+        }
+        else if (arg == "--record" && hasValue)
+        {
+            options.recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && hasValue)
+        {
+            options.replayPath = argv[++i];
+        }
+        else if (arg == "--calibrate")
+        {
+            options.calibrate = true;
+        }
+        else if (arg == "--stream-music")
+        {
+            options.streamMusic = true;
+        }
+        else if (arg == "--song-cache-policy" && hasValue)
+        {
+            std::string policy = argv[++i];
+            if (policy == "lru")
+                options.songCachePolicy = CACHE_LRU;
+            else if (policy == "fifo")
+                options.songCachePolicy = CACHE_FIFO;
+            else
+            {
+                printUsage(argv[0]);
+                return false;
+            }
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
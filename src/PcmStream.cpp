@@ -0,0 +1,42 @@
+#include <PcmStream.hpp>
+
+#include <algorithm>
+
+PcmStream::~PcmStream()
+{
+    // El hilo de audio usa onGetData; hay que detenerlo antes de destruir los datos
+    stop();
+}
+
+void PcmStream::setSong(std::shared_ptr<const DecodedSong> newSong)
+{
+    stop();
+    song = std::move(newSong);
+    position = 0;
+    if (!song)
+        return;
+
+    // Bloques de 100 ms
+    chunkSamples = std::max<std::size_t>(song->channelCount, song->sampleRate / 10 * song->channelCount);
+    initialize(song->channelCount, song->sampleRate);
+}
+
+bool PcmStream::onGetData(Chunk &data)
+{
+    if (!song || position >= song->samples.size())
+        return false;
+
+    std::size_t count = std::min(chunkSamples, song->samples.size() - position);
+    data.samples = song->samples.data() + position;
+    data.sampleCount = count;
+    position += count;
+    return position < song->samples.size();
+}
+
+void PcmStream::onSeek(sf::Time timeOffset)
+{
+    if (!song)
+        return;
+    std::size_t frame = static_cast<std::size_t>(timeOffset.asSeconds() * song->sampleRate);
+    position = std::min(song->samples.size(), frame * song->channelCount);
+}
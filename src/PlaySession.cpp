@@ -0,0 +1,155 @@
+#include <PlaySession.hpp>
+
+#include <LaneLayout.hpp>
+#include <cmath>
+#include <limits>
+
+void PlaySession::reset(const DifficultySettings &settings, const std::vector<Nota> &notes, unsigned int seed,
+                        float simulationHz)
+{
+    simulation.start(settings, notes, seed);
+    simStep = 1.f / simulationHz;
+    simTime = 0.f;
+    stepCount = 0;
+    nextEvent = 0;
+    musicStopped = false;
+    finished = false;
+    playbackPresses.clear();
+}
+
+void PlaySession::start(const DifficultySettings &settings, const std::vector<Nota> &notes, Difficulty difficulty,
+                        const std::string &chartFile, unsigned int seed, float simulationHz)
+{
+    reset(settings, notes, seed, simulationHz);
+    playback = nullptr;
+    recording.reset(difficulty, chartFile, seed, simulationHz);
+}
+
+void PlaySession::startPlayback(const DifficultySettings &settings, const std::vector<Nota> &notes,
+                                const Replay &replay)
+{
+    reset(settings, notes, replay.getSeed(), replay.getSimulationHz());
+    playback = &replay;
+    recording.reset(replay.getDifficulty(), replay.getChartFile(), replay.getSeed(), replay.getSimulationHz());
+}
+
+void PlaySession::record(ReplayEventType type, int column, std::int32_t value)
+{
+    recording.addEvent({stepCount, type, static_cast<std::uint8_t>(column), value});
+}
+
+Judgement PlaySession::press(int column, float time)
+{
+    if (playback || finished || simulation.getState() != PLAYING)
+        return MISS;
+
+    // El golpe se guarda en microsegundos relativos al paso actual y se juzga
+    // con ese mismo valor redondeado, asi la repeticion juzga exactamente igual
+    double offset = std::round((static_cast<double>(time) - simTime) * 1e6);
+    offset = std::fmax(offset, std::numeric_limits<std::int32_t>::min());
+    offset = std::fmin(offset, std::numeric_limits<std::int32_t>::max());
+    std::int32_t offsetUs = static_cast<std::int32_t>(offset);
+    record(REPLAY_PRESS, column, offsetUs);
+    return simulation.press(column, simTime + static_cast<float>(offsetUs) * 1e-6f);
+}
+
+void PlaySession::step()
+{
+    simTime += simStep;
+    simulation.update(simTime, musicStopped);
+    ++stepCount;
+}
+
+bool PlaySession::applyRecordedEvents()
+{
+    const std::vector<ReplayEvent> &events = playback->getEvents();
+    while (nextEvent < events.size() && events[nextEvent].step == stepCount)
+    {
+        const ReplayEvent &event = events[nextEvent++];
+        switch (event.type)
+        {
+        case REPLAY_PRESS:
+            if (CurrentLayout::isValidLane(event.column))
+            {
+                simulation.press(event.column, simTime + static_cast<float>(event.value) * 1e-6f);
+                playbackPresses.push_back(event.column);
+            }
+            break;
+        case REPLAY_SKIP:
+            simTime += static_cast<float>(event.value) * simStep;
+            break;
+        case REPLAY_MUSIC_STOPPED:
+            musicStopped = true;
+            break;
+        case REPLAY_END:
+            return false;
+        }
+    }
+    return nextEvent < events.size();
+}
+
+void PlaySession::advance(float songTime, bool newMusicStopped)
+{
+    if (finished)
+        return;
+
+    if (playback)
+    {
+        playbackPresses.clear();
+        while (true)
+        {
+            bool more = applyRecordedEvents();
+            if (!more || simulation.getState() != PLAYING)
+            {
+                finish();
+                return;
+            }
+            if (simTime + simStep > songTime)
+                return;
+            step();
+        }
+    }
+
+    // La musica solo pasa de sonando a detenida; se graba el paso en que paso
+    if (newMusicStopped && !musicStopped)
+    {
+        musicStopped = true;
+        record(REPLAY_MUSIC_STOPPED, 0, 0);
+    }
+
+    float behind = std::floor((songTime - simTime) / simStep);
+    if (behind > MAX_SIM_STEPS_PER_FRAME)
+    {
+        std::int32_t skipped = static_cast<std::int32_t>(behind) - MAX_SIM_STEPS_PER_FRAME;
+        simTime += static_cast<float>(skipped) * simStep;
+        record(REPLAY_SKIP, 0, skipped);
+    }
+    while (simTime + simStep <= songTime && simulation.getState() == PLAYING)
+        step();
+
+    if (simulation.getState() != PLAYING)
+        finish();
+}
+
+void PlaySession::finish()
+{
+    if (finished)
+        return;
+    finished = true;
+    if (!playback)
+    {
+        record(REPLAY_END, 0, 0);
+        recording.setResult(getResult());
+    }
+}
+
+ReplayResult PlaySession::getResult() const
+{
+    ReplayResult result;
+    result.state = simulation.getState();
+    result.score = simulation.getScore();
+    result.perfectCount = simulation.getPerfectCount();
+    result.goodCount = simulation.getGoodCount();
+    result.stepCount = stepCount;
+    return result;
+}
@@ -0,0 +1,162 @@
+#include <Replay.hpp>
+
+#include <MappedFile.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+// Un evento sin valor: el paso (varint de 1 byte o mas) y el tipo
+const std::size_t MIN_EVENT_BYTES = 2;
+
+void writeVarint(std::string &out, std::uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+bool readVarint(const unsigned char *&cursor, const unsigned char *end, std::uint32_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 35 && cursor < end; shift += 7)
+    {
+        unsigned char byte = *cursor++;
+        value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// Los golpes pueden llegar un poco antes del paso actual, asi que el signo
+// va en el bit bajo para que los valores chicos sigan ocupando un byte
+std::uint32_t zigzag(std::int32_t value)
+{
+    return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+}
+
+std::int32_t unzigzag(std::uint32_t value)
+{
+    return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1);
+}
+}
+
+void Replay::reset(Difficulty newDifficulty, const std::string &newChartFile, unsigned int newSeed,
+                   float newSimulationHz)
+{
+    difficulty = newDifficulty;
+    chartFile = newChartFile;
+    seed = newSeed;
+    simulationHz = newSimulationHz;
+    events.clear();
+    result = ReplayResult();
+}
+
+std::size_t Replay::getPressCount() const
+{
+    std::size_t count = 0;
+    for (const ReplayEvent &event : events)
+        if (event.type == REPLAY_PRESS)
+            ++count;
+    return count;
+}
+
+bool Replay::saveToFile(const std::string &path) const
+{
+    ReplayHeader header;
+    std::memcpy(header.magic, REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    header.version = REPLAY_VERSION;
+    header.difficulty = static_cast<std::uint8_t>(difficulty);
+    header.finalState = static_cast<std::uint8_t>(result.state);
+    header.seed = seed;
+    header.simulationHz = simulationHz;
+    header.eventCount = static_cast<std::uint32_t>(events.size());
+    header.nameLength = static_cast<std::uint32_t>(chartFile.size());
+    header.score = static_cast<std::uint32_t>(result.score);
+    header.perfectCount = static_cast<std::uint32_t>(result.perfectCount);
+    header.goodCount = static_cast<std::uint32_t>(result.goodCount);
+    header.stepCount = result.stepCount;
+
+    std::string body;
+    std::uint32_t lastStep = 0;
+    for (const ReplayEvent &event : events)
+    {
+        writeVarint(body, event.step - lastStep);
+        lastStep = event.step;
+        body.push_back(static_cast<char>(event.type | (event.column << 2)));
+        if (event.type == REPLAY_PRESS)
+            writeVarint(body, zigzag(event.value));
+        else if (event.type == REPLAY_SKIP)
+            writeVarint(body, static_cast<std::uint32_t>(event.value));
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        return false;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(chartFile.data(), static_cast<std::streamsize>(chartFile.size()));
+    out.write(body.data(), static_cast<std::streamsize>(body.size()));
+    return static_cast<bool>(out);
+}
+
+bool Replay::loadFromFile(const std::string &path)
+{
+    MappedFile file;
+    if (!file.open(path))
+        return false;
+
+    ReplayHeader header;
+    if (file.getSize() < sizeof(header))
+        return false;
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if (std::memcmp(header.magic, REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0 || header.version != REPLAY_VERSION ||
+        header.difficulty > HARD || header.simulationHz <= 0.f)
+        return false;
+
+    const unsigned char *cursor = file.getData() + sizeof(header);
+    const unsigned char *end = file.getData() + file.getSize();
+    if (static_cast<std::size_t>(end - cursor) < header.nameLength)
+        return false;
+
+    reset(static_cast<Difficulty>(header.difficulty), std::string(reinterpret_cast<const char *>(cursor), header.nameLength),
+          header.seed, header.simulationHz);
+    cursor += header.nameLength;
+
+    // Un conteo que no cabe en lo que queda del archivo es un archivo corrupto;
+    // se rechaza antes de reservar memoria para el
+    if (header.eventCount > static_cast<std::size_t>(end - cursor) / MIN_EVENT_BYTES)
+        return false;
+
+    std::uint32_t step = 0;
+    events.reserve(header.eventCount);
+    for (std::uint32_t i = 0; i < header.eventCount; ++i)
+    {
+        std::uint32_t delta = 0;
+        if (!readVarint(cursor, end, delta) || cursor >= end)
+            return false;
+        step += delta;
+        unsigned char kind = *cursor++;
+
+        ReplayEvent event{step, static_cast<ReplayEventType>(kind & 3), static_cast<std::uint8_t>(kind >> 2), 0};
+        std::uint32_t value = 0;
+        if (event.type == REPLAY_PRESS || event.type == REPLAY_SKIP)
+        {
+            if (!readVarint(cursor, end, value))
+                return false;
+            event.value = event.type == REPLAY_PRESS ? unzigzag(value) : static_cast<std::int32_t>(value);
+        }
+        events.push_back(event);
+    }
+
+    result.state = static_cast<GameState>(header.finalState);
+    result.score = static_cast<int>(header.score);
+    result.perfectCount = static_cast<int>(header.perfectCount);
+    result.goodCount = static_cast<int>(header.goodCount);
+    result.stepCount = header.stepCount;
+    return true;
+}
@@ -0,0 +1,123 @@
+#include <Simulation.hpp>
+
+#include <LaneLayout.hpp>
+#include <algorithm>
+#include <cmath>
+
+void Simulation::start(const DifficultySettings &newSettings, const std::vector<Nota> &notes, unsigned int seed)
+{
+    settings = newSettings;
+    scheduler.reset(notes);
+    tiles.reset(maxTilesOnScreen());
+    for (auto &lane : lanes)
+        lane.reset(tiles.capacity());
+    rng.seed(seed);
+    songTime = 0.f;
+    score = 0;
+    starsEarned = 0;
+    perfectCount = 0;
+    goodCount = 0;
+    state = PLAYING;
+}
+
+std::size_t Simulation::maxTilesOnScreen() const
+{
+    // Un tile ocupa un slot desde que aparece arriba hasta que sale por abajo
+    float onScreenTime = (SCREEN_HEIGHT + TILE_HEIGHT) / settings.tileSpeed;
+
+    // Maximo de notas dentro de cualquier ventana de onScreenTime segundos
+    const std::vector<Nota> &notes = scheduler.getNotes();
+    std::size_t maxCount = 0;
+    std::size_t first = 0;
+    for (std::size_t last = 0; last < notes.size(); ++last)
+    {
+        while (notes[last].tiempo - notes[first].tiempo > onScreenTime)
+            ++first;
+        maxCount = std::max(maxCount, last - first + 1);
+    }
+    return maxCount + 1;
+}
+
+void Simulation::spawnTile(const Nota &nota)
+{
+    int column = CurrentLayout::isValidLane(nota.columna) ? nota.columna : static_cast<int>(rng() % NUM_COLUMNS);
+    float y = HIT_LINE_Y - (nota.tiempo - songTime) * settings.tileSpeed;
+    lanes[column].push(tiles.spawn(column, y, songTime, nota.tiempo));
+}
+
+float Simulation::getNextNoteTime(int column) const
+{
+    if (lanes[column].empty())
+        return -1.f;
+    return tiles.getNoteTime(tiles.slotOf(lanes[column].front()));
+}
+
+void Simulation::update(float newSongTime, bool musicStopped)
+{
+    if (state != PLAYING)
+        return;
+
+    songTime = newSongTime;
+    // Un tile aparece arriba justo lead segundos antes de su nota
+    scheduler.advance(songTime + getLeadTime(), [this](const Nota &nota)
+                      { spawnTile(nota); });
+
+    // Los tiles acertados se liberan en press(), asi que aqui ya no hay que compactar
+    float tileSpeed = settings.tileSpeed;
+    float *ys = tiles.yData();
+    const float *noteTimes = tiles.noteTimeData();
+    const std::uint8_t *states = tiles.stateData();
+    for (std::size_t i = 0; i < tiles.size(); ++i)
+    {
+        std::size_t slot = tiles.slotAt(i);
+        if (states[slot] == TilePool::ACTIVE)
+            ys[slot] = HIT_LINE_Y - (noteTimes[slot] - songTime) * tileSpeed;
+    }
+
+    // Una nota que se paso de la ventana sin tocarse es un MISS
+    for (const auto &lane : lanes)
+    {
+        if (!lane.empty() && songTime > tiles.getNoteTime(tiles.slotOf(lane.front())) + hitWindows.miss)
+        {
+            state = GAME_OVER;
+            return;
+        }
+    }
+
+    if (state == PLAYING && musicStopped && scheduler.finished())
+        state = GAME_WIN;
+}
+
+Judgement Simulation::press(int column, float time)
+{
+    if (state != PLAYING)
+        return MISS;
+
+    RingQueue<std::size_t> &lane = lanes[column];
+    if (lane.empty())
+    {
+        state = GAME_OVER;
+        return MISS;
+    }
+
+    std::size_t slot = tiles.slotOf(lane.front());
+    lastOffset = time - tiles.getNoteTime(slot);
+    float delta = std::fabs(lastOffset);
+    if (delta > hitWindows.good)
+    {
+        state = GAME_OVER;
+        return MISS;
+    }
+
+    lane.pop();
+    tiles.retire(slot);
+    score += 10;
+    starsEarned = std::max(starsEarned, score / 100);
+    if (delta <= hitWindows.perfect)
+    {
+        ++perfectCount;
+        return PERFECT;
+    }
+    ++goodCount;
+    return GOOD;
+}
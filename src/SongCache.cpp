@@ -0,0 +1,121 @@
+#include <SongCache.hpp>
+
+#include <Assets.hpp>
+#include <SFML/Audio.hpp>
+#include <iostream>
+
+namespace
+{
+std::shared_ptr<DecodedSong> decode(const Assets &assets, const std::string &path)
+{
+    sf::InputSoundFile file;
+    if (!assets.openSound(file, path))
+        return nullptr;
+
+    auto song = std::make_shared<DecodedSong>();
+    song->channelCount = file.getChannelCount();
+    song->sampleRate = file.getSampleRate();
+    song->samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+    std::size_t read = static_cast<std::size_t>(file.read(song->samples.data(), song->samples.size()));
+    song->samples.resize(read);
+    return song;
+}
+} // namespace
+
+SongCache::SongCache(const Assets &assets, std::size_t maxBytes, CachePolicy policy)
+    : assets(assets), maxBytes(maxBytes), policy(policy)
+{
+}
+
+std::shared_ptr<const DecodedSong> SongCache::get(const std::string &path)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto found = index.find(path);
+    if (found != index.end())
+    {
+        ++hits;
+        if (policy == CACHE_LRU)
+            entries.splice(entries.end(), entries, found->second);
+        return found->second->song;
+    }
+
+    // Si otro hilo ya la esta decodificando (el de carga, por ejemplo) se
+    // espera su resultado en lugar de decodificarla dos veces
+    auto inFlight = pending.find(path);
+    if (inFlight != pending.end())
+    {
+        ++hits;
+        SongFuture future = inFlight->second;
+        lock.unlock();
+        return future.get();
+    }
+
+    ++misses;
+    std::promise<std::shared_ptr<const DecodedSong>> promise;
+    pending[path] = promise.get_future().share();
+    lock.unlock();
+
+    // La decodificacion va sin el candado: pedir otra cancion o las
+    // estadisticas no tiene que esperar a que termine
+    std::shared_ptr<const DecodedSong> song;
+    try
+    {
+        song = decode(assets, path);
+    }
+    catch (...)
+    {
+        lock.lock();
+        pending.erase(path);
+        lock.unlock();
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    lock.lock();
+    if (song)
+        store(path, song);
+    pending.erase(path);
+    lock.unlock();
+    promise.set_value(song);
+    return song;
+}
+
+void SongCache::store(const std::string &path, const std::shared_ptr<const DecodedSong> &song)
+{
+    // Una cancion que no cabe ni sola se reproduce pero no se guarda
+    if (song->getBytes() > maxBytes)
+    {
+        std::cerr << path << " no cabe en el cache de canciones" << std::endl;
+        return;
+    }
+
+    evictFor(song->getBytes());
+    entries.push_back({path, song});
+    index[path] = std::prev(entries.end());
+    ++songs;
+    bytes += song->getBytes();
+}
+
+void SongCache::evictFor(std::size_t size)
+{
+    while (!entries.empty() && bytes + size > maxBytes)
+    {
+        const Entry &oldest = entries.front();
+        bytes -= oldest.song->getBytes();
+        --songs;
+        ++evictions;
+        index.erase(oldest.path);
+        entries.pop_front();
+    }
+}
+
+SongCacheStats SongCache::getStats() const
+{
+    SongCacheStats stats;
+    stats.hits = hits.load(std::memory_order_relaxed);
+    stats.misses = misses.load(std::memory_order_relaxed);
+    stats.evictions = evictions.load(std::memory_order_relaxed);
+    stats.songs = songs.load(std::memory_order_relaxed);
+    stats.bytes = bytes.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,40 @@
+#include <SongClock.hpp>
+
+#include <cmath>
+
+namespace
+{
+// Fraccion del error que se corrige con cada offset nuevo
+const double DRIFT_CORRECTION = 0.1;
+// A partir de este error se salta directo al offset reportado
+const double SNAP_THRESHOLD = 0.1;
+}
+
+void SongClock::reset()
+{
+    lastUpdate = Clock::now();
+    songTime = 0.0;
+    lastReported = -1.f;
+}
+
+float SongClock::update(float reportedOffset, bool playing)
+{
+    Clock::time_point now = Clock::now();
+    double predicted = songTime + std::chrono::duration<double>(now - lastUpdate).count();
+    lastUpdate = now;
+
+    // Solo se corrige cuando el offset reportado cambia: ahi es cuando es exacto
+    if (playing && reportedOffset != lastReported)
+    {
+        double error = reportedOffset - predicted;
+        if (std::fabs(error) > SNAP_THRESHOLD)
+            predicted = reportedOffset;
+        else
+            predicted += error * DRIFT_CORRECTION;
+        lastReported = reportedOffset;
+    }
+
+    if (predicted > songTime)
+        songTime = predicted;
+    return getTime();
+}
@@ -0,0 +1,173 @@
+#include <StreamingMusic.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+// El audio pide bloques de 50 ms
+const float CHUNK_SECONDS = 0.05f;
+// El decodificador lee hasta 4096 frames por vuelta
+const std::size_t DECODE_FRAMES = 4096;
+// Lo que se espera a que se llene el buffer al abrir
+const auto PREFILL_TIMEOUT = std::chrono::milliseconds(200);
+
+std::size_t nextPowerOfTwo(std::size_t value)
+{
+    std::size_t power = 1;
+    while (power < value)
+        power <<= 1;
+    return power;
+}
+} // namespace
+
+StreamingMusic::StreamingMusic(float aheadSeconds) : aheadSeconds(aheadSeconds)
+{
+}
+
+StreamingMusic::~StreamingMusic()
+{
+    // El hilo de audio de SFML usa onGetData; se detiene antes que el decodificador
+    stop();
+    stopDecoder();
+}
+
+bool StreamingMusic::open(const Assets &assets, const std::string &path)
+{
+    stop();
+    stopDecoder();
+    channelCount = 0;
+    if (!assets.openSound(file, path))
+    {
+        std::cerr << "No se pudo abrir " << path << " para streaming" << std::endl;
+        return false;
+    }
+
+    channelCount = file.getChannelCount();
+    sampleRate = file.getSampleRate();
+    // Al menos dos bloques del decodificador, para que nunca se quede sin espacio
+    std::size_t ahead = static_cast<std::size_t>(aheadSeconds * sampleRate) * channelCount;
+    ring.assign(nextPowerOfTwo(std::max(ahead, 2 * DECODE_FRAMES * channelCount)), 0);
+    mask = ring.size() - 1;
+    chunkSamples = std::max<std::size_t>(1, static_cast<std::size_t>(CHUNK_SECONDS * sampleRate)) * channelCount;
+    chunk.resize(chunkSamples);
+    initialize(channelCount, sampleRate);
+    startDecoder();
+
+    // Empieza a sonar con el buffer lleno para no tener un faltante de entrada
+    auto deadline = std::chrono::steady_clock::now() + PREFILL_TIMEOUT;
+    while (buffered() + DECODE_FRAMES * channelCount <= ring.size() && !endOfFile.load(std::memory_order_acquire) &&
+           std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    underruns = 0;
+    stallMicroseconds = 0;
+    minBuffered = ring.size();
+    return true;
+}
+
+StreamingStats StreamingMusic::getStats() const
+{
+    StreamingStats stats;
+    stats.underruns = underruns.load(std::memory_order_relaxed);
+    stats.stallMs = stallMicroseconds.load(std::memory_order_relaxed) / 1000.0;
+    if (isOpen())
+        stats.minBufferedMs = 1000.0 * minBuffered.load(std::memory_order_relaxed) / channelCount / sampleRate;
+    return stats;
+}
+
+std::size_t StreamingMusic::buffered() const
+{
+    return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_relaxed);
+}
+
+void StreamingMusic::startDecoder()
+{
+    stopping = false;
+    endOfFile = false;
+    readIndex = 0;
+    writeIndex = 0;
+    decoder = std::thread([this]()
+                          { decode(); });
+}
+
+void StreamingMusic::stopDecoder()
+{
+    stopping = true;
+    if (decoder.joinable())
+        decoder.join();
+}
+
+void StreamingMusic::decode()
+{
+    std::vector<sf::Int16> block(DECODE_FRAMES * channelCount);
+    while (!stopping.load(std::memory_order_relaxed))
+    {
+        std::size_t write = writeIndex.load(std::memory_order_relaxed);
+        std::size_t space = ring.size() - (write - readIndex.load(std::memory_order_acquire));
+        if (space < block.size())
+        {
+            // Buffer lleno: el audio consume un bloque de DECODE_FRAMES en ~90 ms
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            continue;
+        }
+
+        std::size_t count = static_cast<std::size_t>(file.read(block.data(), block.size()));
+        if (count == 0)
+        {
+            endOfFile.store(true, std::memory_order_release);
+            return;
+        }
+        std::size_t start = write & mask;
+        std::size_t first = std::min(count, ring.size() - start);
+        std::copy(block.begin(), block.begin() + first, ring.begin() + start);
+        std::copy(block.begin() + first, block.begin() + count, ring.begin());
+        writeIndex.store(write + count, std::memory_order_release);
+    }
+}
+
+bool StreamingMusic::onGetData(Chunk &data)
+{
+    // Con el buffer vacio se espera al decodificador; nunca se queda esperando
+    // para siempre porque el decodificador solo para al final del archivo
+    std::size_t available = buffered();
+    if (available == 0 && !endOfFile.load(std::memory_order_acquire))
+    {
+        ++underruns;
+        auto begin = std::chrono::steady_clock::now();
+        while (buffered() == 0 && !endOfFile.load(std::memory_order_acquire))
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        auto waited = std::chrono::steady_clock::now() - begin;
+        stallMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(waited).count();
+        available = buffered();
+    }
+    // Al final del archivo el buffer se vacia solo; eso no es un faltante
+    if (!endOfFile.load(std::memory_order_acquire) && available < minBuffered.load(std::memory_order_relaxed))
+        minBuffered.store(available, std::memory_order_relaxed);
+    if (available == 0)
+        return false;
+
+    std::size_t read = readIndex.load(std::memory_order_relaxed);
+    std::size_t count = std::min(available, chunkSamples);
+    std::size_t start = read & mask;
+    std::size_t first = std::min(count, ring.size() - start);
+    std::copy(ring.begin() + start, ring.begin() + start + first, chunk.begin());
+    std::copy(ring.begin(), ring.begin() + (count - first), chunk.begin() + first);
+    readIndex.store(read + count, std::memory_order_release);
+
+    data.samples = chunk.data();
+    data.sampleCount = count;
+    return true;
+}
+
+void StreamingMusic::onSeek(sf::Time timeOffset)
+{
+    // SFML llama esto con su hilo de audio detenido (al parar o al mover la
+    // posicion), asi que se puede reiniciar el buffer sin carreras
+    if (!isOpen())
+        return;
+    stopDecoder();
+    file.seek(timeOffset);
+    startDecoder();
+}
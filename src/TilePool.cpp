@@ -0,0 +1,85 @@
+#include <TilePool.hpp>
+
+#include <algorithm>
+
+void TilePool::reset(std::size_t minCapacity)
+{
+    std::size_t newCapacity = std::max<std::size_t>(capacity(), 8);
+    while (newCapacity < minCapacity)
+        newCapacity *= 2;
+
+    if (newCapacity != capacity())
+    {
+        columns.resize(newCapacity);
+        ys.resize(newCapacity);
+        spawnTimes.resize(newCapacity);
+        noteTimes.resize(newCapacity);
+        states.resize(newCapacity);
+        mask = newCapacity - 1;
+    }
+    std::fill(states.begin(), states.end(), FREE);
+    headSequence = 0;
+    count = 0;
+    active = 0;
+}
+
+void TilePool::grow()
+{
+    // Solo pasa si la estimacion de capacidad se quedo corta: se duplica y cada
+    // tile se acomoda en el slot que le toca con la mascara nueva
+    std::size_t newCapacity = capacity() * 2;
+    std::size_t newMask = newCapacity - 1;
+    std::vector<std::uint8_t> newColumns(newCapacity);
+    std::vector<float> newYs(newCapacity);
+    std::vector<float> newSpawnTimes(newCapacity);
+    std::vector<float> newNoteTimes(newCapacity);
+    std::vector<std::uint8_t> newStates(newCapacity, FREE);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::size_t sequence = headSequence + i;
+        std::size_t from = sequence & mask;
+        std::size_t to = sequence & newMask;
+        newColumns[to] = columns[from];
+        newYs[to] = ys[from];
+        newSpawnTimes[to] = spawnTimes[from];
+        newNoteTimes[to] = noteTimes[from];
+        newStates[to] = states[from];
+    }
+    columns.swap(newColumns);
+    ys.swap(newYs);
+    spawnTimes.swap(newSpawnTimes);
+    noteTimes.swap(newNoteTimes);
+    states.swap(newStates);
+    mask = newMask;
+}
+
+std::size_t TilePool::spawn(int column, float y, float spawnTime, float noteTime)
+{
+    if (count == capacity())
+        grow();
+    std::size_t sequence = headSequence + count;
+    std::size_t slot = slotOf(sequence);
+    columns[slot] = static_cast<std::uint8_t>(column);
+    ys[slot] = y;
+    spawnTimes[slot] = spawnTime;
+    noteTimes[slot] = noteTime;
+    states[slot] = ACTIVE;
+    ++count;
+    ++active;
+    return sequence;
+}
+
+void TilePool::retire(std::size_t slot)
+{
+    if (states[slot] != ACTIVE)
+        return;
+    states[slot] = HIT;
+    --active;
+    // Libera los slots de la cabeza que ya no estan activos
+    while (count > 0 && states[headSequence & mask] != ACTIVE)
+    {
+        states[headSequence & mask] = FREE;
+        ++headSequence;
+        --count;
+    }
+}
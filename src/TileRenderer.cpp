@@ -0,0 +1,52 @@
+#include <TileRenderer.hpp>
+
+namespace
+{
+const float OUTLINE_THICKNESS = 1.f;
+}
+
+TileRenderer::TileRenderer(const GlyphAtlas &atlas, sf::Vector2f tileSize, unsigned int characterSize)
+    : atlas(atlas), tileSize(tileSize), characterSize(characterSize),
+      quads(sf::Quads), glyphs(sf::Quads)
+{
+}
+
+void TileRenderer::clear()
+{
+    quads.clear();
+    glyphs.clear();
+    tileCount = 0;
+}
+
+void TileRenderer::addTile(sf::Vector2f position, char letter)
+{
+    // El borde se dibuja como un quad blanco un poco mas grande y el relleno
+    // negro encima, igual que el outline de sf::RectangleShape
+    appendQuad(quads,
+               sf::FloatRect(position.x - OUTLINE_THICKNESS, position.y - OUTLINE_THICKNESS,
+                             tileSize.x + 2.f * OUTLINE_THICKNESS, tileSize.y + 2.f * OUTLINE_THICKNESS),
+               sf::Color::White);
+    appendQuad(quads, sf::FloatRect(position, tileSize), sf::Color::Black);
+    atlas.appendCentered(glyphs, characterSize, letter,
+                         {position.x + tileSize.x / 2.f, position.y + tileSize.y / 2.f}, sf::Color::White);
+    ++tileCount;
+}
+
+std::size_t TileRenderer::draw(sf::RenderTarget &target) const
+{
+    if (tileCount == 0)
+        return 0;
+    target.draw(quads);
+    target.draw(glyphs, sf::RenderStates(&atlas.getTexture()));
+    return 2;
+}
+
+void TileRenderer::appendQuad(sf::VertexArray &array, sf::FloatRect rect, sf::Color color)
+{
+    float right = rect.left + rect.width;
+    float bottom = rect.top + rect.height;
+    array.append(sf::Vertex({rect.left, rect.top}, color));
+    array.append(sf::Vertex({right, rect.top}, color));
+    array.append(sf::Vertex({right, bottom}, color));
+    array.append(sf::Vertex({rect.left, bottom}, color));
+}
@@ -0,0 +1,47 @@
+#include <TimingStats.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+double TimingStats::getMean() const
+{
+    if (values.empty())
+        return 0.0;
+    double sum = 0.0;
+    for (double value : values)
+        sum += value;
+    return sum / values.size();
+}
+
+double TimingStats::getStdDev() const
+{
+    if (values.size() < 2)
+        return 0.0;
+    double mean = getMean();
+    double squares = 0.0;
+    for (double value : values)
+        squares += (value - mean) * (value - mean);
+    return std::sqrt(squares / (values.size() - 1));
+}
+
+double TimingStats::getAbsPercentile(double percentile) const
+{
+    if (values.empty())
+        return 0.0;
+    std::vector<double> sorted;
+    sorted.reserve(values.size());
+    for (double value : values)
+        sorted.push_back(std::fabs(value));
+    std::size_t index = static_cast<std::size_t>(percentile / 100.0 * (sorted.size() - 1) + 0.5);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+std::string TimingStats::describe() const
+{
+    char buffer[128];
+    std::snprintf(buffer, sizeof(buffer), "n=%zu media=%+.2f ms desv=%.2f ms |p50|=%.2f ms |p99|=%.2f ms",
+                  getCount(), getMean(), getStdDev(), getAbsPercentile(50.0), getAbsPercentile(99.0));
+    return buffer;
+}
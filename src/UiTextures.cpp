@@ -0,0 +1,162 @@
+#include <UiTextures.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+const unsigned int ATLAS_MIN_WIDTH = 256;
+const int ATLAS_PADDING = 1;
+
+std::vector<ImageRequest> makeRequests(const std::vector<UiImageSpec> &specs)
+{
+    std::vector<ImageRequest> requests;
+    for (const UiImageSpec &spec : specs)
+        requests.push_back({spec.name, spec.size});
+    return requests;
+}
+} // namespace
+
+UiTextures::UiTextures(const Assets &assets, const std::vector<UiImageSpec> &specs)
+    : specs(specs), loader(assets, makeRequests(specs)), textures(specs.size()), rects(specs.size()),
+      done(specs.size(), false), ready(specs.size(), false)
+{
+}
+
+bool UiTextures::wait(std::size_t index)
+{
+    if (specs[index].packed)
+    {
+        for (std::size_t i = 0; i < specs.size(); ++i)
+        {
+            if (specs[i].packed)
+                loader.wait(i);
+        }
+    }
+    else
+    {
+        loader.wait(index);
+    }
+    update();
+    return ready[index];
+}
+
+bool UiTextures::update()
+{
+    bool changed = false;
+    bool atlasDecoded = true;
+    for (std::size_t i = 0; i < specs.size(); ++i)
+    {
+        if (specs[i].packed)
+        {
+            atlasDecoded = atlasDecoded && loader.isDecoded(i);
+        }
+        else if (!done[i] && loader.isDecoded(i))
+        {
+            uploadSingle(i);
+            changed = true;
+        }
+    }
+    if (!atlasDone && atlasDecoded)
+    {
+        buildAtlas();
+        changed = true;
+    }
+    if (changed && std::all_of(done.begin(), done.end(), [](bool value)
+                               { return value; }))
+        std::cout << "Texturas de la interfaz: " << getTextureBytes() / 1024 << " KB" << std::endl;
+    return changed;
+}
+
+void UiTextures::uploadSingle(std::size_t index)
+{
+    done[index] = true;
+    if (!loader.isOk(index))
+    {
+        std::cerr << "Error al cargar " << specs[index].name << std::endl;
+        return;
+    }
+
+    const sf::Image &image = loader.getImage(index);
+    ready[index] = textures[index].loadFromImage(image);
+    rects[index] = sf::IntRect(0, 0, static_cast<int>(image.getSize().x), static_cast<int>(image.getSize().y));
+    std::cout << specs[index].name << ": " << image.getSize().x << "x" << image.getSize().y << ", decodificada en "
+              << loader.getDecodeMs(index) << " ms, reescalada en " << loader.getResampleMs(index) << " ms"
+              << std::endl;
+    loader.release(index);
+}
+
+void UiTextures::buildAtlas()
+{
+    atlasDone = true;
+
+    // Acomoda las imagenes en filas (shelf packing), de la mas alta a la mas baja
+    std::vector<std::size_t> order;
+    unsigned int width = ATLAS_MIN_WIDTH;
+    for (std::size_t i = 0; i < specs.size(); ++i)
+    {
+        if (!specs[i].packed)
+            continue;
+        done[i] = true;
+        if (!loader.isOk(i))
+        {
+            std::cerr << "Error al cargar " << specs[i].name << std::endl;
+            continue;
+        }
+        order.push_back(i);
+        width = std::max(width, loader.getImage(i).getSize().x + 2 * ATLAS_PADDING);
+    }
+    if (order.empty())
+        return;
+    std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b)
+              { return loader.getImage(a).getSize().y > loader.getImage(b).getSize().y; });
+
+    int x = ATLAS_PADDING;
+    int y = ATLAS_PADDING;
+    int rowHeight = 0;
+    for (std::size_t i : order)
+    {
+        sf::Vector2u size = loader.getImage(i).getSize();
+        if (x + static_cast<int>(size.x) + ATLAS_PADDING > static_cast<int>(width))
+        {
+            x = ATLAS_PADDING;
+            y += rowHeight + ATLAS_PADDING;
+            rowHeight = 0;
+        }
+        rects[i] = sf::IntRect(x, y, static_cast<int>(size.x), static_cast<int>(size.y));
+        x += static_cast<int>(size.x) + ATLAS_PADDING;
+        rowHeight = std::max(rowHeight, static_cast<int>(size.y));
+    }
+
+    sf::Image image;
+    image.create(width, static_cast<unsigned int>(y + rowHeight + ATLAS_PADDING), sf::Color(0, 0, 0, 0));
+    for (std::size_t i : order)
+    {
+        image.copy(loader.getImage(i), static_cast<unsigned int>(rects[i].left),
+                   static_cast<unsigned int>(rects[i].top));
+        std::cout << specs[i].name << ": " << rects[i].width << "x" << rects[i].height << " en el atlas, decodificada en "
+                  << loader.getDecodeMs(i) << " ms, reescalada en " << loader.getResampleMs(i) << " ms" << std::endl;
+        loader.release(i);
+    }
+    if (!atlas.loadFromImage(image))
+        return;
+    for (std::size_t i : order)
+        ready[i] = true;
+}
+
+bool UiTextures::applyTo(std::size_t index, sf::Sprite &sprite) const
+{
+    if (!ready[index])
+        return false;
+    sprite.setTexture(specs[index].packed ? atlas : textures[index]);
+    sprite.setTextureRect(rects[index]);
+    return true;
+}
+
+std::size_t UiTextures::getTextureBytes() const
+{
+    std::size_t bytes = static_cast<std::size_t>(atlas.getSize().x) * atlas.getSize().y * 4;
+    for (const sf::Texture &texture : textures)
+        bytes += static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+    return bytes;
+}
@@ -0,0 +1,66 @@
+// Empaqueta una carpeta de assets en un solo archivo .pak.
+// Uso: ./assetpack [carpeta (assets)] [salida (assets.pak)]
+
+#include <AssetPack.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char **argv)
+{
+    fs::path root = fs::path(argc >= 2 ? argv[1] : "assets").lexically_normal();
+    if (root.filename().empty())
+        root = root.parent_path();
+    std::string output = argc >= 3 ? argv[2] : "assets.pak";
+
+    if (!fs::is_directory(root))
+    {
+        std::fprintf(stderr, "Error: '%s' no es una carpeta\n", root.string().c_str());
+        return 1;
+    }
+
+    // Los nombres incluyen la carpeta raiz ("assets/..."), igual que las
+    // rutas que usa el juego; los archivos ocultos (.DS_Store) se omiten
+    std::vector<AssetPack::Source> sources;
+    std::uintmax_t totalBytes = 0;
+    for (const auto &entry : fs::recursive_directory_iterator(root))
+    {
+        if (!entry.is_regular_file() || entry.path().filename().string()[0] == '.')
+            continue;
+        std::string name = (root.filename() / entry.path().lexically_relative(root)).generic_string();
+        sources.push_back({name, entry.path().string()});
+        totalBytes += entry.file_size();
+    }
+
+    if (!AssetPack::build(output, sources))
+    {
+        std::fprintf(stderr, "Error: no se pudo escribir '%s'\n", output.c_str());
+        return 1;
+    }
+
+    // Verifica que cada archivo se encuentre en el paquete con su tamano
+    AssetPack check;
+    if (!check.open(output) || check.getEntryCount() != sources.size())
+    {
+        std::fprintf(stderr, "Error: '%s' quedo invalido\n", output.c_str());
+        return 1;
+    }
+    for (const auto &source : sources)
+    {
+        AssetData asset = check.find(source.name);
+        if (!asset || asset.size != fs::file_size(source.path))
+        {
+            std::fprintf(stderr, "Error: '%s' no quedo bien en el paquete\n", source.name.c_str());
+            return 1;
+        }
+    }
+
+    std::printf("%s -> %s (%zu archivos, %.1f MB de datos, %.1f MB en total)\n", root.string().c_str(),
+                output.c_str(), sources.size(), totalBytes / (1024.0 * 1024.0),
+                fs::file_size(output) / (1024.0 * 1024.0));
+    return 0;
+}
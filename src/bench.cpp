@@ -0,0 +1,186 @@
+// Bench de la simulacion: corre charts completos con un reloj virtual y un
+// jugador automatico, mas rapido que en tiempo real, y reporta cuanto cuesta
+// cada update. Uso: ./piano_bench [chart.chart|chart.txt] [--repeat N] [--dt segundos] [--seed N]
+//
+// Con --replay f.replay reproduce una partida grabada a maxima velocidad, sin
+// ventana ni audio, y verifica que termine igual que la original.
+
+#include <AutoPlayer.hpp>
+#include <Chart.hpp>
+#include <Difficulty.hpp>
+#include <PlaySession.hpp>
+#include <Simulation.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct BenchResult
+{
+    long long ticks = 0;
+    double simulatedSeconds = 0.0;
+    double wallSeconds = 0.0;
+    int score = 0;
+    int perfect = 0;
+    int good = 0;
+    GameState finalState = PLAYING;
+};
+
+BenchResult runChart(const DifficultySettings &settings, const std::vector<Nota> &notes, float songLength, float dt,
+                     unsigned int seed)
+{
+    BenchResult result;
+    Simulation simulation;
+    simulation.start(settings, notes, seed);
+
+    float songTime = 0.f;
+    auto begin = std::chrono::steady_clock::now();
+    // Tope por si el jugador automatico nunca termina la partida
+    const long long maxTicks = static_cast<long long>((songLength + 10.f) / dt);
+    while (simulation.getState() == PLAYING && result.ticks < maxTicks)
+    {
+        songTime += dt;
+        simulation.update(songTime, songTime >= songLength);
+        autoplay(simulation, dt);
+        ++result.ticks;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    result.simulatedSeconds = songTime;
+    result.wallSeconds = std::chrono::duration<double>(end - begin).count();
+    result.score = simulation.getScore();
+    result.perfect = simulation.getPerfectCount();
+    result.good = simulation.getGoodCount();
+    result.finalState = simulation.getState();
+    return result;
+}
+
+const char *stateName(GameState state)
+{
+    switch (state)
+    {
+    case GAME_WIN:
+        return "GANO";
+    case GAME_OVER:
+        return "PERDIO";
+    default:
+        return "JUGANDO";
+    }
+}
+
+int runReplay(const std::string &replayFile, const std::map<Difficulty, DifficultySettings> &difficulties,
+              int repeat)
+{
+    Replay replay;
+    if (!replay.loadFromFile(replayFile))
+    {
+        std::fprintf(stderr, "Error: no se pudo leer la repeticion '%s'\n", replayFile.c_str());
+        return 1;
+    }
+    Chart chart;
+    if (!chart.loadFromFile(replay.getChartFile()))
+    {
+        std::fprintf(stderr, "Error: no se pudo abrir el chart '%s'\n", replay.getChartFile().c_str());
+        return 1;
+    }
+    std::vector<Nota> notes = chart.getNotes();
+    std::printf("repeticion: %s (%s, %zu golpes, %.0f Hz, semilla %u)\n", replayFile.c_str(),
+                replay.getChartFile().c_str(), replay.getPressCount(), replay.getSimulationHz(), replay.getSeed());
+
+    PlaySession session;
+    double wallSeconds = 0.0;
+    long long steps = 0;
+    for (int r = 0; r < repeat; ++r)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        session.startPlayback(difficulties.at(replay.getDifficulty()), notes, replay);
+        session.advance(std::numeric_limits<float>::infinity(), false);
+        wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        steps += session.getStepCount();
+    }
+
+    ReplayResult expected = replay.getResult();
+    ReplayResult result = session.getResult();
+    bool identical = session.matchesRecording();
+    std::printf("%9lld pasos  %8.1f ns/paso  %8.0fx tiempo real\n", steps, wallSeconds * 1e9 / steps,
+                steps / replay.getSimulationHz() / wallSeconds);
+    std::printf("grabado:    puntaje %d (%d perfect, %d good, %s) en %u pasos\n", expected.score,
+                expected.perfectCount, expected.goodCount, stateName(expected.state), expected.stepCount);
+    std::printf("reproducido: puntaje %d (%d perfect, %d good, %s) en %u pasos -> %s\n", result.score,
+                result.perfectCount, result.goodCount, stateName(result.state), result.stepCount,
+                identical ? "identico" : "DIFERENTE");
+    return identical ? 0 : 1;
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::string chartFile = "assets/beats/beats.chart";
+    int repeat = 20;
+    float dt = 1.f / 240.f; // mismo paso fijo que usa el juego por defecto
+    unsigned int seed = 1234;
+    std::string replayFile;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--repeat" && i + 1 < argc)
+            repeat = std::atoi(argv[++i]);
+        else if (arg == "--dt" && i + 1 < argc)
+            dt = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--seed" && i + 1 < argc)
+            seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (arg == "--replay" && i + 1 < argc)
+            replayFile = argv[++i];
+        else
+            chartFile = arg;
+    }
+
+    std::map<Difficulty, DifficultySettings> difficulties = makeDifficulties();
+    if (!replayFile.empty())
+        return runReplay(replayFile, difficulties, repeat);
+
+    Chart chart;
+    if (!chart.loadFromFile(chartFile) && chart.loadFromText(chartFile))
+        chart.sortByTime();
+    std::vector<Nota> notes = chart.getNotes();
+    if (notes.empty())
+    {
+        std::fprintf(stderr, "Error: el chart '%s' esta vacio o no existe\n", chartFile.c_str());
+        return 1;
+    }
+
+    const char *names[] = {"EASY", "MEDIUM", "HARD"};
+
+    float songLength = chart.getTimes()[chart.size() - 1] + 3.f;
+    std::printf("chart: %s (%zu notas, %.1f s), dt = %.4f s, repeticiones = %d\n",
+                chartFile.c_str(), notes.size(), songLength, dt, repeat);
+
+    for (const auto &entry : difficulties)
+    {
+        BenchResult total;
+        for (int r = 0; r < repeat; ++r)
+        {
+            BenchResult run = runChart(entry.second, notes, songLength, dt, seed);
+            total.ticks += run.ticks;
+            total.simulatedSeconds += run.simulatedSeconds;
+            total.wallSeconds += run.wallSeconds;
+            total.score = run.score;
+            total.perfect = run.perfect;
+            total.good = run.good;
+            total.finalState = run.finalState;
+        }
+        std::printf("%-7s %9lld ticks  %10.0f ticks/s  %8.1f ns/update  %8.0fx tiempo real  "
+                    "puntaje %d (%d perfect, %d good, %s)\n",
+                    names[entry.first], total.ticks, total.ticks / total.wallSeconds,
+                    total.wallSeconds * 1e9 / total.ticks, total.simulatedSeconds / total.wallSeconds,
+                    total.score, total.perfect, total.good, stateName(total.finalState));
+    }
+    return 0;
+}
@@ -0,0 +1,368 @@
+// Revisa todos los charts de una carpeta (por defecto assets/beats) antes de
+// publicarlos. Cada chart se juega en cada dificultad con un jugador perfecto
+// y se reportan carriles fuera de rango, tiles que se enciman o que no se
+// pueden tocar y el pico de notas por segundo. Los charts se revisan en
+// paralelo, uno por hilo a la vez.
+// Uso: ./chartcheck [carpeta|chart ...] [--threads N] [--seed N]
+// Devuelve 1 si algun chart tiene errores.
+
+#include <AutoPlayer.hpp>
+#include <Chart.hpp>
+#include <Difficulty.hpp>
+#include <DifficultySettings.hpp>
+#include <LaneLayout.hpp>
+#include <Simulation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+// Mismo paso fijo que usa el juego por defecto
+const float SIM_STEP = 1.f / 240.f;
+// Cuantos ejemplos de cada problema se imprimen por chart
+const std::size_t MAX_EXAMPLES = 3;
+
+struct DifficultyReport
+{
+    std::size_t overlaps = 0; // tiles del mismo carril que se enciman en pantalla
+    std::size_t stacked = 0; // notas del mismo carril en el mismo instante
+    std::vector<float> examples; // tiempos de algunos de los anteriores
+    GameState finalState = PLAYING;
+    float lostAt = 0.f; // si el jugador perfecto perdio, en que segundo
+};
+
+struct ChartReport
+{
+    fs::path path;
+    bool loaded = false;
+    bool unsorted = false;
+    bool staleBinary = false; // el .chart no coincide con su .txt
+    std::size_t notes = 0;
+    float length = 0.f;
+    std::size_t outOfRange = 0;
+    std::vector<float> outOfRangeExamples;
+    int maxColumn = -1;
+    bool usesLaneZero = false;
+    int smallestLayout = 0; // menor distribucion en la que caben sus carriles (0 = ninguna)
+    std::size_t peakNotes = 0; // maximo de notas en un segundo
+    float peakAt = 0.f;
+    std::map<Difficulty, DifficultyReport> difficulties;
+    double milliseconds = 0.0;
+
+    bool hasErrors() const
+    {
+        if (!loaded || outOfRange > 0 || staleBinary)
+            return true;
+        for (const auto &entry : difficulties)
+            if (entry.second.stacked > 0 || entry.second.finalState != GAME_WIN)
+                return true;
+        return false;
+    }
+};
+
+const char *difficultyName(Difficulty difficulty)
+{
+    switch (difficulty)
+    {
+    case EASY:
+        return "EASY";
+    case MEDIUM:
+        return "MEDIUM";
+    default:
+        return "HARD";
+    }
+}
+
+template <int Lanes>
+bool fitsLayout(const std::vector<Nota> &notes)
+{
+    return std::all_of(notes.begin(), notes.end(), [](const Nota &nota)
+                       { return nota.columna == CHART_NO_COLUMN || LaneLayout<Lanes>::isValidLane(nota.columna); });
+}
+
+int findSmallestLayout(const std::vector<Nota> &notes)
+{
+    if (fitsLayout<4>(notes))
+        return 4;
+    if (fitsLayout<5>(notes))
+        return 5;
+    if (fitsLayout<6>(notes))
+        return 6;
+    if (fitsLayout<7>(notes))
+        return 7;
+    if (fitsLayout<8>(notes))
+        return 8;
+    return 0;
+}
+
+bool loadChart(const fs::path &path, Chart &chart)
+{
+    if (path.extension() == ".txt")
+        return chart.loadFromText(path.string());
+    return chart.loadFromFile(path.string());
+}
+
+bool sameNotes(const std::vector<Nota> &a, const std::vector<Nota> &b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const Nota &x, const Nota &y)
+                      { return x.tiempo == y.tiempo && x.columna == y.columna; });
+}
+
+// Juega el chart con un jugador perfecto (como el de piano_bench) y revisa
+// cada tile al aparecer contra el anterior de su carril
+DifficultyReport simulate(const DifficultySettings &settings, const std::vector<Nota> &notes, float length,
+                          unsigned int seed)
+{
+    DifficultyReport report;
+    Simulation simulation;
+    simulation.start(settings, notes, seed);
+    const TilePool &tiles = simulation.getTiles();
+
+    std::array<float, NUM_COLUMNS> lastNoteTime;
+    lastNoteTime.fill(-1e9f);
+    std::size_t spawned = 0;
+    float songTime = 0.f;
+    const float end = length + 3.f;
+    while (simulation.getState() == PLAYING && songTime < end + 10.f)
+    {
+        songTime += SIM_STEP;
+        simulation.update(songTime, songTime >= end);
+
+        // Los tiles nuevos son los ultimos del pool, en orden de aparicion
+        std::size_t fresh = simulation.getNoteIndex() - spawned;
+        spawned = simulation.getNoteIndex();
+        for (std::size_t i = tiles.size() - fresh; i < tiles.size(); ++i)
+        {
+            std::size_t slot = tiles.slotAt(i);
+            int column = tiles.getColumn(slot);
+            float gap = tiles.getNoteTime(slot) - lastNoteTime[column];
+            lastNoteTime[column] = tiles.getNoteTime(slot);
+            if (gap * settings.tileSpeed >= TILE_HEIGHT)
+                continue;
+            if (gap <= 0.f)
+                ++report.stacked;
+            else
+                ++report.overlaps;
+            if (report.examples.size() < MAX_EXAMPLES)
+                report.examples.push_back(tiles.getNoteTime(slot));
+        }
+
+        autoplay(simulation, SIM_STEP);
+    }
+    report.finalState = simulation.getState();
+    report.lostAt = songTime;
+    return report;
+}
+
+ChartReport checkChart(const fs::path &path, const std::map<Difficulty, DifficultySettings> &difficulties,
+                       unsigned int seed)
+{
+    auto begin = std::chrono::steady_clock::now();
+    ChartReport report;
+    report.path = path;
+
+    Chart chart;
+    report.loaded = loadChart(path, chart) && !chart.empty();
+    if (!report.loaded)
+        return report;
+    std::vector<Nota> notes = chart.getNotes();
+    auto byTime = [](const Nota &a, const Nota &b)
+    { return a.tiempo < b.tiempo; };
+    report.unsorted = !std::is_sorted(notes.begin(), notes.end(), byTime);
+    if (report.unsorted)
+        std::stable_sort(notes.begin(), notes.end(), byTime);
+    report.notes = notes.size();
+    report.length = notes.back().tiempo;
+
+    // Un .chart junto a su .txt debe tener exactamente las mismas notas
+    fs::path text = fs::path(path).replace_extension(".txt");
+    if (path.extension() == ".chart" && fs::exists(text))
+    {
+        Chart source;
+        if (source.loadFromText(text.string()))
+            source.sortByTime();
+        report.staleBinary = !sameNotes(source.getNotes(), notes);
+    }
+
+    for (const Nota &nota : notes)
+    {
+        if (nota.columna == CHART_NO_COLUMN)
+            continue;
+        report.maxColumn = std::max<int>(report.maxColumn, nota.columna);
+        report.usesLaneZero = report.usesLaneZero || nota.columna == 0;
+        if (!CurrentLayout::isValidLane(nota.columna))
+        {
+            ++report.outOfRange;
+            if (report.outOfRangeExamples.size() < MAX_EXAMPLES)
+                report.outOfRangeExamples.push_back(nota.tiempo);
+        }
+    }
+    report.smallestLayout = findSmallestLayout(notes);
+
+    // Maximo de notas dentro de cualquier ventana de un segundo
+    std::size_t first = 0;
+    for (std::size_t last = 0; last < notes.size(); ++last)
+    {
+        while (notes[last].tiempo - notes[first].tiempo >= 1.f)
+            ++first;
+        if (last - first + 1 > report.peakNotes)
+        {
+            report.peakNotes = last - first + 1;
+            report.peakAt = notes[first].tiempo;
+        }
+    }
+
+    for (const auto &entry : difficulties)
+        report.difficulties[entry.first] = simulate(entry.second, notes, report.length, seed);
+
+    report.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return report;
+}
+
+std::string formatTimes(const std::vector<float> &times, std::size_t total)
+{
+    std::string text;
+    for (float time : times)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%s%.2fs", text.empty() ? "" : ", ", time);
+        text += buffer;
+    }
+    if (total > times.size())
+        text += ", ...";
+    return text;
+}
+
+void printReport(const ChartReport &report)
+{
+    std::printf("%s %s\n", report.hasErrors() ? "ERROR" : "ok   ", report.path.string().c_str());
+    if (!report.loaded)
+    {
+        std::printf("      no se pudo leer o esta vacio\n");
+        return;
+    }
+    std::printf("      %zu notas, %.1f s, pico %zu notas/s en %.1f s, %.1f ms\n", report.notes, report.length,
+                report.peakNotes, report.peakAt, report.milliseconds);
+    if (report.unsorted)
+        std::printf("      aviso: las notas no estan ordenadas por tiempo\n");
+    if (report.staleBinary)
+        std::printf("      error: no coincide con su .txt; correr 'make charts'\n");
+    if (report.outOfRange > 0)
+    {
+        std::printf("      error: %zu notas fuera de los carriles 0-%d (%s)\n", report.outOfRange, NUM_COLUMNS - 1,
+                    formatTimes(report.outOfRangeExamples, report.outOfRange).c_str());
+        if (!report.usesLaneZero && report.maxColumn == NUM_COLUMNS)
+            std::printf("      parece que sus carriles empiezan en 1\n");
+        if (report.smallestLayout > 0)
+            std::printf("      cabe en la distribucion de %d carriles\n", report.smallestLayout);
+    }
+
+    for (const auto &entry : report.difficulties)
+    {
+        const DifficultyReport &difficulty = entry.second;
+        if (difficulty.overlaps > 0 || difficulty.stacked > 0)
+            std::printf("      %s %-6s %zu tiles encimados, %zu en el mismo instante (%s)\n",
+                        difficulty.stacked > 0 ? "error:" : "aviso:", difficultyName(entry.first), difficulty.overlaps,
+                        difficulty.stacked,
+                        formatTimes(difficulty.examples, difficulty.overlaps + difficulty.stacked).c_str());
+        if (difficulty.finalState != GAME_WIN)
+            std::printf("      error: %-6s un jugador perfecto pierde en %.2f s\n", difficultyName(entry.first),
+                        difficulty.lostAt);
+    }
+}
+
+void collectCharts(const fs::path &path, std::vector<fs::path> &charts)
+{
+    if (!fs::is_directory(path))
+    {
+        charts.push_back(path);
+        return;
+    }
+    // Cada cancion una vez: su .chart, o su .txt si no tiene binario
+    std::vector<fs::path> found;
+    for (const auto &entry : fs::recursive_directory_iterator(path))
+    {
+        const fs::path &file = entry.path();
+        if (!entry.is_regular_file())
+            continue;
+        if (file.extension() == ".chart" ||
+            (file.extension() == ".txt" && !fs::exists(fs::path(file).replace_extension(".chart"))))
+            found.push_back(file);
+    }
+    std::sort(found.begin(), found.end());
+    charts.insert(charts.end(), found.begin(), found.end());
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::vector<fs::path> inputs;
+    unsigned int threads = 0;
+    unsigned int seed = 1234;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc)
+            threads = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (arg == "--seed" && i + 1 < argc)
+            seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else
+            inputs.push_back(arg);
+    }
+    if (inputs.empty())
+        inputs.push_back("assets/beats");
+
+    std::vector<fs::path> charts;
+    for (const fs::path &input : inputs)
+        collectCharts(input, charts);
+    if (charts.empty())
+    {
+        std::fprintf(stderr, "Error: no hay charts que revisar\n");
+        return 1;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    const std::map<Difficulty, DifficultySettings> difficulties = makeDifficulties();
+    std::vector<ChartReport> reports(charts.size());
+
+    // Cada hilo toma el siguiente chart pendiente hasta que no quede ninguno;
+    // los reportes se imprimen despues en orden
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned int>(std::min<std::size_t>(threads, charts.size()));
+    std::atomic<std::size_t> nextChart{0};
+    auto work = [&]()
+    {
+        for (std::size_t index = nextChart++; index < charts.size(); index = nextChart++)
+            reports[index] = checkChart(charts[index], difficulties, seed);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned int t = 1; t < threads; ++t)
+        workers.emplace_back(work);
+    work();
+    for (auto &worker : workers)
+        worker.join();
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    std::size_t failed = 0;
+    for (const ChartReport &report : reports)
+    {
+        printReport(report);
+        failed += report.hasErrors() ? 1 : 0;
+    }
+    std::printf("%zu charts, %zu con errores, %d carriles, semilla %u, %u hilos, %.1f ms\n", reports.size(), failed,
+                NUM_COLUMNS, seed, threads, milliseconds);
+    return failed > 0 ? 1 : 0;
+}
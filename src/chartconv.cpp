@@ -0,0 +1,53 @@
+// Convierte los charts de texto (assets/beats/*.txt) al formato binario .chart.
+// Uso: ./chartconv entrada.txt [salida.chart]
+
+#include <Chart.hpp>
+
+#include <cstdio>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Uso: %s entrada.txt [salida.chart]\n", argv[0]);
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output;
+    if (argc >= 3)
+    {
+        output = argv[2];
+    }
+    else
+    {
+        std::size_t dot = input.find_last_of('.');
+        output = (dot == std::string::npos ? input : input.substr(0, dot)) + ".chart";
+    }
+
+    Chart chart;
+    if (!chart.loadFromText(input))
+    {
+        std::fprintf(stderr, "Error: no se pudo leer '%s'\n", input.c_str());
+        return 1;
+    }
+    if (chart.sortByTime())
+        std::fprintf(stderr, "Aviso: los tiempos de '%s' no estaban ordenados; se ordenaron\n", input.c_str());
+    if (!chart.saveToFile(output))
+    {
+        std::fprintf(stderr, "Error: no se pudo escribir '%s'\n", output.c_str());
+        return 1;
+    }
+
+    // Verifica que el archivo nuevo se pueda mapear
+    Chart check;
+    if (!check.loadFromFile(output) || check.size() != chart.size())
+    {
+        std::fprintf(stderr, "Error: '%s' quedo invalido\n", output.c_str());
+        return 1;
+    }
+
+    std::printf("%s -> %s (%zu notas)\n", input.c_str(), output.c_str(), chart.size());
+    return 0;
+}
@@ -0,0 +1,190 @@
+// Genera un chart a partir de una cancion: detecta los golpes por flujo
+// espectral y les asigna carril segun el timbre.
+// Uso: ./chartgen cancion.wav [salida.chart] [--level easy|medium|hard] [--threads N]
+
+#include <Chart.hpp>
+#include <Config.hpp>
+#include <DifficultySettings.hpp>
+#include <OnsetDetector.hpp>
+#include <SFML/Audio.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Densidad de notas de cada nivel. La velocidad sale de makeDifficulties(),
+// la misma tabla del juego: de ella sale la separacion minima entre dos notas
+// del mismo carril para que sus tiles no se encimen.
+struct ChartDensity
+{
+    const char *name;
+    Difficulty difficulty;
+    float delta;  // que tanto debe sobresalir un golpe del promedio local
+    float minGap; // segundos minimos entre dos notas cualesquiera
+};
+
+const ChartDensity DENSITIES[] = {
+    {"easy", EASY, 1.0f, 0.40f},
+    {"medium", MEDIUM, 0.6f, 0.20f},
+    {"hard", HARD, 0.3f, 0.12f},
+};
+
+// Lee toda la cancion y la mezcla a mono
+bool decodeMono(const std::string &path, std::vector<float> &mono, unsigned int &sampleRate)
+{
+    sf::InputSoundFile file;
+    if (!file.openFromFile(path))
+        return false;
+
+    unsigned int channels = file.getChannelCount();
+    sampleRate = file.getSampleRate();
+    mono.clear();
+    mono.reserve(static_cast<std::size_t>(file.getSampleCount() / channels));
+
+    std::vector<sf::Int16> block(4096 * channels);
+    const float scale = 1.f / (32768.f * channels);
+    sf::Uint64 read;
+    while ((read = file.read(block.data(), block.size())) > 0)
+    {
+        for (sf::Uint64 i = 0; i + channels <= read; i += channels)
+        {
+            int sum = 0;
+            for (unsigned int c = 0; c < channels; ++c)
+                sum += block[i + c];
+            mono.push_back(sum * scale);
+        }
+    }
+    return true;
+}
+
+// Carril segun el timbre: los golpes graves van a la izquierda y los agudos a
+// la derecha, por cuantiles del centroide. Si el carril elegido todavia tiene
+// un tile que se encimaria, se usa el carril libre mas cercano.
+std::vector<std::uint8_t> assignLanes(const std::vector<Onset> &onsets, float laneGap)
+{
+    std::vector<std::uint8_t> lanes(onsets.size());
+    if (onsets.empty())
+        return lanes;
+
+    std::vector<float> sorted;
+    sorted.reserve(onsets.size());
+    for (const Onset &onset : onsets)
+        sorted.push_back(onset.centroid);
+    std::sort(sorted.begin(), sorted.end());
+    std::array<float, NUM_COLUMNS - 1> cuts;
+    for (int c = 0; c < NUM_COLUMNS - 1; ++c)
+        cuts[c] = sorted[(c + 1) * sorted.size() / NUM_COLUMNS];
+
+    std::array<float, NUM_COLUMNS> lastTime;
+    lastTime.fill(-laneGap);
+    for (std::size_t i = 0; i < onsets.size(); ++i)
+    {
+        int wanted = static_cast<int>(std::upper_bound(cuts.begin(), cuts.end(), onsets[i].centroid) - cuts.begin());
+        int lane = -1;
+        for (int distance = 0; distance < NUM_COLUMNS && lane < 0; ++distance)
+        {
+            for (int candidate : {wanted - distance, wanted + distance})
+            {
+                if (candidate >= 0 && candidate < NUM_COLUMNS && onsets[i].time - lastTime[candidate] >= laneGap)
+                {
+                    lane = candidate;
+                    break;
+                }
+            }
+        }
+        if (lane < 0)
+            lane = static_cast<int>(std::min_element(lastTime.begin(), lastTime.end()) - lastTime.begin());
+        lanes[i] = static_cast<std::uint8_t>(lane);
+        lastTime[lane] = onsets[i].time;
+    }
+    return lanes;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string input;
+    std::string output;
+    const ChartDensity *density = &DENSITIES[1];
+    OnsetSettings onsetSettings;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--level" && i + 1 < argc)
+        {
+            std::string level = argv[++i];
+            density = nullptr;
+            for (const ChartDensity &candidate : DENSITIES)
+            {
+                if (level == candidate.name)
+                    density = &candidate;
+            }
+            if (!density)
+            {
+                std::fprintf(stderr, "Error: nivel desconocido '%s' (easy, medium o hard)\n", level.c_str());
+                return 1;
+            }
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+            onsetSettings.threads = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (input.empty())
+            input = arg;
+        else
+            output = arg;
+    }
+
+    if (input.empty())
+    {
+        std::fprintf(stderr, "Uso: %s cancion.wav [salida.chart] [--level easy|medium|hard] [--threads N]\n", argv[0]);
+        return 1;
+    }
+    if (output.empty())
+    {
+        std::size_t dot = input.find_last_of('.');
+        output = (dot == std::string::npos ? input : input.substr(0, dot)) + ".chart";
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<float> mono;
+    unsigned int sampleRate = 0;
+    if (!decodeMono(input, mono, sampleRate))
+    {
+        std::fprintf(stderr, "Error: no se pudo leer '%s'\n", input.c_str());
+        return 1;
+    }
+    auto decoded = std::chrono::steady_clock::now();
+
+    OnsetDetector detector(onsetSettings);
+    detector.analyze(mono.data(), mono.size(), sampleRate);
+    std::vector<Onset> onsets = detector.pickOnsets(density->delta, density->minGap);
+    auto analyzed = std::chrono::steady_clock::now();
+
+    DifficultySettings settings = makeDifficulties()[density->difficulty];
+    float laneGap = TILE_HEIGHT / settings.tileSpeed;
+    std::vector<float> times;
+    times.reserve(onsets.size());
+    for (const Onset &onset : onsets)
+        times.push_back(onset.time);
+
+    Chart chart;
+    chart.setNotes(times, assignLanes(onsets, laneGap));
+    if (!chart.saveToFile(output))
+    {
+        std::fprintf(stderr, "Error: no se pudo escribir '%s'\n", output.c_str());
+        return 1;
+    }
+
+    float seconds = static_cast<float>(mono.size()) / sampleRate;
+    std::printf("%s -> %s (%s): %zu notas en %.1f s (%.2f notas/s)\n", input.c_str(), output.c_str(), density->name,
+                chart.size(), seconds, seconds > 0.f ? chart.size() / seconds : 0.f);
+    std::printf("decodificar %.0f ms, analizar %zu ventanas con %u hilos %.0f ms\n",
+                std::chrono::duration<double, std::milli>(decoded - begin).count(), detector.getFrameCount(),
+                detector.getThreadCount(), std::chrono::duration<double, std::milli>(analyzed - decoded).count());
+    return 0;
+}
@@ -0,0 +1,351 @@
+// Microbenchmarks de lo que corre en cada nivel y cada cuadro: parseo del
+// chart, aparicion de tiles, update de la simulacion, busqueda del golpe y
+// armado de vertices, con 10, 100 y 1000 tiles en pantalla. Cada caso se mide
+// varias veces y se reporta la mediana; con --save se guarda una linea base y
+// con --compare se compara contra ella.
+// Uso: ./piano_microbench [--samples N] [--save archivo] [--compare archivo] [--threshold porcentaje]
+
+#include <Chart.hpp>
+#include <Config.hpp>
+#include <GlyphAtlas.hpp>
+#include <LaneLayout.hpp>
+#include <Simulation.hpp>
+#include <TileRenderer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// La dificultad HARD del juego y el tamano de las letras de sus tiles
+const DifficultySettings SETTINGS = makeDifficulties()[HARD];
+const unsigned int TILE_LETTER_SIZE = static_cast<unsigned int>(TILE_HEIGHT * 0.6f);
+const float SONG_SECONDS = 60.f;
+// Trabajo aproximado (en tiles) de cada muestra, para que ninguna dure
+// tan poco que el reloj la domine
+const std::size_t WORK_PER_SAMPLE = 1000000;
+
+volatile std::size_t sink = 0;
+
+struct Measurement
+{
+    std::string name;
+    double medianNs = 0.0;
+    double p10Ns = 0.0;
+    double p90Ns = 0.0;
+};
+
+// Notas con exactamente 'tiles' tiles en pantalla en el segundo getStartTime():
+// una cada lead/tiles segundos, repartidas en los carriles
+struct Scenario
+{
+    std::size_t tiles;
+    float spacing;
+    std::vector<Nota> notes;
+    std::vector<unsigned char> chartBytes;
+
+    float getStartTime() const { return notes.front().tiempo - spacing / 2.f; }
+};
+
+Scenario makeScenario(std::size_t tiles)
+{
+    Simulation probe;
+    probe.start(SETTINGS, {}, 0);
+    float lead = probe.getLeadTime();
+
+    Scenario scenario;
+    scenario.tiles = tiles;
+    scenario.spacing = lead / static_cast<float>(tiles);
+    std::size_t count = static_cast<std::size_t>(SONG_SECONDS / scenario.spacing);
+    std::vector<float> times(count);
+    std::vector<std::uint8_t> columns(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        times[i] = lead + scenario.spacing * static_cast<float>(i);
+        columns[i] = static_cast<std::uint8_t>(i % NUM_COLUMNS);
+        scenario.notes.push_back({times[i], columns[i]});
+    }
+
+    // El chart se escribe con el mismo codigo que chartconv y se lee de memoria
+    Chart chart;
+    chart.setNotes(times, columns);
+    std::string path = (std::filesystem::temp_directory_path() / "piano_microbench.chart").string();
+    if (chart.saveToFile(path))
+    {
+        std::ifstream in(path, std::ios::binary);
+        scenario.chartBytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    std::remove(path.c_str());
+    return scenario;
+}
+
+// Simulacion recien llenada con los tiles del escenario
+Simulation makeFilledSimulation(const Scenario &scenario)
+{
+    Simulation simulation;
+    simulation.start(SETTINGS, scenario.notes, 0);
+    simulation.update(scenario.getStartTime(), false);
+    return simulation;
+}
+
+double percentile(std::vector<double> values, double p)
+{
+    std::sort(values.begin(), values.end());
+    std::size_t index = static_cast<std::size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+    return values[index];
+}
+
+// Corre 'samples' muestras (mas dos de calentamiento). setup() no se mide;
+// run() devuelve cuantas operaciones hizo.
+template <typename Setup, typename Run>
+Measurement measure(const std::string &name, int samples, Setup setup, Run run)
+{
+    std::vector<double> perOp;
+    for (int s = 0; s < samples + 2; ++s)
+    {
+        setup();
+        auto begin = Clock::now();
+        std::size_t ops = run();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+        if (s >= 2 && ops > 0)
+            perOp.push_back(ns / static_cast<double>(ops));
+    }
+    return {name, percentile(perOp, 0.5), percentile(perOp, 0.1), percentile(perOp, 0.9)};
+}
+
+void runScenario(const Scenario &scenario, const GlyphAtlas &atlas, int samples, std::vector<Measurement> &results)
+{
+    const std::size_t tiles = scenario.tiles;
+    const std::string suffix = "/" + std::to_string(tiles);
+    const float startTime = scenario.getStartTime();
+    const Simulation filled = makeFilledSimulation(scenario);
+    const std::size_t batch = std::max<std::size_t>(1, WORK_PER_SAMPLE / tiles / 10);
+    const std::size_t repeat = std::max<std::size_t>(1, WORK_PER_SAMPLE / tiles);
+
+    // Lo que hace LevelLoader al preparar un nivel: validar el chart y copiar las notas
+    results.push_back(measure("chart" + suffix, samples, [] {},
+                              [&]
+                              {
+                                  for (std::size_t r = 0; r < batch; ++r)
+                                  {
+                                      Chart chart;
+                                      chart.loadFromMemory(scenario.chartBytes.data(), scenario.chartBytes.size());
+                                      sink = sink + chart.getNotes().size();
+                                  }
+                                  return batch;
+                              }));
+
+    // El primer update de la partida hace aparecer todos los tiles de golpe
+    std::vector<Simulation> fresh;
+    Simulation started;
+    started.start(SETTINGS, scenario.notes, 0);
+    results.push_back(measure("spawn" + suffix, samples, [&] { fresh.assign(batch, started); },
+                              [&]
+                              {
+                                  for (Simulation &simulation : fresh)
+                                      simulation.update(startTime, false);
+                                  return fresh.size();
+                              }));
+
+    // Un paso de simulacion con la pantalla llena (sin nuevas apariciones)
+    Simulation steady = filled;
+    results.push_back(measure("update" + suffix, samples, [] {},
+                              [&]
+                              {
+                                  for (std::size_t r = 0; r < repeat; ++r)
+                                      steady.update(startTime, false);
+                                  return repeat;
+                              }));
+
+    // Buscar la nota mas proxima de los carriles y juzgarla, hasta vaciar la pantalla
+    std::vector<Simulation> full;
+    results.push_back(measure("hit" + suffix, samples, [&] { full.assign(batch, filled); },
+                              [&]
+                              {
+                                  std::size_t presses = 0;
+                                  for (Simulation &simulation : full)
+                                  {
+                                      while (true)
+                                      {
+                                          int column = -1;
+                                          float noteTime = 0.f;
+                                          for (int c = 0; c < NUM_COLUMNS; ++c)
+                                          {
+                                              float t = simulation.getNextNoteTime(c);
+                                              if (t >= 0.f && (column < 0 || t < noteTime))
+                                              {
+                                                  column = c;
+                                                  noteTime = t;
+                                              }
+                                          }
+                                          if (column < 0)
+                                              break;
+                                          simulation.press(column, noteTime);
+                                          ++presses;
+                                      }
+                                  }
+                                  return presses;
+                              }));
+
+    // Armar los quads de todos los tiles de un cuadro, igual que el juego
+    TileRenderer renderer(atlas, {COLUMN_WIDTH - 2.f, TILE_HEIGHT}, TILE_LETTER_SIZE);
+    results.push_back(measure("vertices" + suffix, samples, [] {},
+                              [&]
+                              {
+                                  const TilePool &pool = filled.getTiles();
+                                  for (std::size_t r = 0; r < repeat; ++r)
+                                  {
+                                      renderer.clear();
+                                      for (std::size_t i = 0; i < pool.size(); ++i)
+                                      {
+                                          std::size_t slot = pool.slotAt(i);
+                                          if (!pool.isActive(slot))
+                                              continue;
+                                          int column = pool.getColumn(slot);
+                                          renderer.addTile({COLUMN_WIDTH * column + 1.f, filled.getTileY(slot, startTime)},
+                                                           CurrentLayout::LETTERS[column]);
+                                      }
+                                      sink = sink + renderer.getTileCount();
+                                  }
+                                  return repeat;
+                              }));
+
+    if (filled.getTiles().activeCount() != tiles)
+        std::fprintf(stderr, "Aviso: el escenario de %zu tiles tiene %zu en pantalla\n", tiles,
+                     filled.getTiles().activeCount());
+}
+
+bool saveBaseline(const std::string &path, const std::vector<Measurement> &results)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+    out << "# piano_microbench: caso mediana_ns p10_ns p90_ns\n";
+    for (const Measurement &m : results)
+        out << m.name << ' ' << m.medianNs << ' ' << m.p10Ns << ' ' << m.p90Ns << '\n';
+    return static_cast<bool>(out);
+}
+
+bool loadBaseline(const std::string &path, std::map<std::string, Measurement> &baseline)
+{
+    std::ifstream in(path);
+    if (!in)
+        return false;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream fields(line);
+        Measurement m;
+        if (fields >> m.name >> m.medianNs >> m.p10Ns >> m.p90Ns)
+            baseline[m.name] = m;
+    }
+    return true;
+}
+}
+
+int main(int argc, char **argv)
+{
+    int samples = 25;
+    std::string savePath;
+    std::string comparePath;
+    double threshold = 10.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--samples" && i + 1 < argc)
+            samples = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--save" && i + 1 < argc)
+            savePath = argv[++i];
+        else if (arg == "--compare" && i + 1 < argc)
+            comparePath = argv[++i];
+        else if (arg == "--threshold" && i + 1 < argc)
+            threshold = std::atof(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "Uso: %s [--samples N] [--save archivo] [--compare archivo] [--threshold porcentaje]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+
+    // Sin la fuente los tiles se arman sin letra; el resto del caso es igual
+    sf::Font font;
+    GlyphAtlas atlas;
+    std::string laneLetters(CurrentLayout::LETTERS.begin(), CurrentLayout::LETTERS.end());
+    if (!font.loadFromFile("assets/Orbitron-Regular.ttf") || !atlas.build(font, {{TILE_LETTER_SIZE, laneLetters}}))
+        std::fprintf(stderr, "Aviso: sin fuente, 'vertices' no incluye las letras\n");
+
+    std::vector<Measurement> results;
+    for (std::size_t tiles : {10, 100, 1000})
+        runScenario(makeScenario(tiles), atlas, samples, results);
+
+    std::map<std::string, Measurement> baseline;
+    if (!comparePath.empty() && !loadBaseline(comparePath, baseline))
+    {
+        std::fprintf(stderr, "Error: no se pudo leer la linea base '%s'\n", comparePath.c_str());
+        return 1;
+    }
+
+    std::printf("%-14s %12s %12s %12s %9s", "caso", "mediana ns", "p10 ns", "p90 ns", "disp.");
+    if (!baseline.empty())
+        std::printf(" %12s %8s", "base ns", "cambio");
+    std::printf("\n");
+
+    int regressions = 0;
+    for (const Measurement &m : results)
+    {
+        std::printf("%-14s %12.1f %12.1f %12.1f %8.1f%%", m.name.c_str(), m.medianNs, m.p10Ns, m.p90Ns,
+                    100.0 * (m.p90Ns - m.p10Ns) / m.medianNs);
+        auto entry = baseline.find(m.name);
+        if (entry != baseline.end() && entry->second.medianNs > 0.0)
+        {
+            // Solo cuenta si la mediana se movio mas que el umbral y los
+            // rangos p10-p90 de las dos corridas ni se tocan; asi el ruido de
+            // la maquina no se reporta como cambio
+            const Measurement &base = entry->second;
+            double change = 100.0 * (m.medianNs - base.medianNs) / base.medianNs;
+            const char *verdict = "";
+            if (change > threshold && m.p10Ns > base.p90Ns)
+            {
+                verdict = "  REGRESION";
+                ++regressions;
+            }
+            else if (change < -threshold && m.p90Ns < base.p10Ns)
+            {
+                verdict = "  mejora";
+            }
+            std::printf(" %12.1f %+7.1f%%%s", base.medianNs, change, verdict);
+        }
+        std::printf("\n");
+    }
+
+    if (!savePath.empty())
+    {
+        if (!saveBaseline(savePath, results))
+        {
+            std::fprintf(stderr, "Error al escribir '%s'\n", savePath.c_str());
+            return 1;
+        }
+        std::printf("Linea base guardada en %s\n", savePath.c_str());
+    }
+    if (regressions > 0)
+    {
+        std::printf("%d casos mas lentos que la linea base (umbral %.0f%%)\n", regressions, threshold);
+        return 1;
+    }
+    return 0;
+}